@@ -0,0 +1,165 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_AstTestSuite_init = false;
+#include "/root/repo/tests/ast_tests.h"
+
+static AstTestSuite suite_AstTestSuite;
+
+static CxxTest::List Tests_AstTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AstTestSuite( "tests/ast_tests.h", 59, "AstTestSuite", suite_AstTestSuite, Tests_AstTestSuite );
+
+static class TestDescription_suite_AstTestSuite_test_symbol_table_interns : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_symbol_table_interns() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 110, "test_symbol_table_interns" ) {}
+ void runTest() { suite_AstTestSuite.test_symbol_table_interns(); }
+} testDescription_suite_AstTestSuite_test_symbol_table_interns;
+
+static class TestDescription_suite_AstTestSuite_test_parse_interns_names : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_parse_interns_names() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 132, "test_parse_interns_names" ) {}
+ void runTest() { suite_AstTestSuite.test_parse_interns_names(); }
+} testDescription_suite_AstTestSuite_test_parse_interns_names;
+
+static class TestDescription_suite_AstTestSuite_test_emit_to_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_emit_to_file() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 148, "test_emit_to_file" ) {}
+ void runTest() { suite_AstTestSuite.test_emit_to_file(); }
+} testDescription_suite_AstTestSuite_test_emit_to_file;
+
+static class TestDescription_suite_AstTestSuite_test_emit_deep_expression : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_emit_deep_expression() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 172, "test_emit_deep_expression" ) {}
+ void runTest() { suite_AstTestSuite.test_emit_deep_expression(); }
+} testDescription_suite_AstTestSuite_test_emit_deep_expression;
+
+static class TestDescription_suite_AstTestSuite_test_walker_counts_nodes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_walker_counts_nodes() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 183, "test_walker_counts_nodes" ) {}
+ void runTest() { suite_AstTestSuite.test_walker_counts_nodes(); }
+} testDescription_suite_AstTestSuite_test_walker_counts_nodes;
+
+static class TestDescription_suite_AstTestSuite_test_walker_rewrites : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_walker_rewrites() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 196, "test_walker_rewrites" ) {}
+ void runTest() { suite_AstTestSuite.test_walker_rewrites(); }
+} testDescription_suite_AstTestSuite_test_walker_rewrites;
+
+static class TestDescription_suite_AstTestSuite_test_walk_deep_expression : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_walk_deep_expression() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 206, "test_walk_deep_expression" ) {}
+ void runTest() { suite_AstTestSuite.test_walk_deep_expression(); }
+} testDescription_suite_AstTestSuite_test_walk_deep_expression;
+
+static class TestDescription_suite_AstTestSuite_test_type_checker_types_exprs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_type_checker_types_exprs() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 219, "test_type_checker_types_exprs" ) {}
+ void runTest() { suite_AstTestSuite.test_type_checker_types_exprs(); }
+} testDescription_suite_AstTestSuite_test_type_checker_types_exprs;
+
+static class TestDescription_suite_AstTestSuite_test_type_checker_reports_errors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_type_checker_reports_errors() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 252, "test_type_checker_reports_errors" ) {}
+ void runTest() { suite_AstTestSuite.test_type_checker_reports_errors(); }
+} testDescription_suite_AstTestSuite_test_type_checker_reports_errors;
+
+static class TestDescription_suite_AstTestSuite_test_type_checker_compares_numbers_only : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_type_checker_compares_numbers_only() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 272, "test_type_checker_compares_numbers_only" ) {}
+ void runTest() { suite_AstTestSuite.test_type_checker_compares_numbers_only(); }
+} testDescription_suite_AstTestSuite_test_type_checker_compares_numbers_only;
+
+static class TestDescription_suite_AstTestSuite_test_simplifier_folds_constants : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_simplifier_folds_constants() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 298, "test_simplifier_folds_constants" ) {}
+ void runTest() { suite_AstTestSuite.test_simplifier_folds_constants(); }
+} testDescription_suite_AstTestSuite_test_simplifier_folds_constants;
+
+static class TestDescription_suite_AstTestSuite_test_simplifier_drops_groups : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_simplifier_drops_groups() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 319, "test_simplifier_drops_groups" ) {}
+ void runTest() { suite_AstTestSuite.test_simplifier_drops_groups(); }
+} testDescription_suite_AstTestSuite_test_simplifier_drops_groups;
+
+static class TestDescription_suite_AstTestSuite_test_dead_code_prunes_branches : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_dead_code_prunes_branches() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 340, "test_dead_code_prunes_branches" ) {}
+ void runTest() { suite_AstTestSuite.test_dead_code_prunes_branches(); }
+} testDescription_suite_AstTestSuite_test_dead_code_prunes_branches;
+
+static class TestDescription_suite_AstTestSuite_test_dead_code_removes_unread_variables : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_dead_code_removes_unread_variables() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 362, "test_dead_code_removes_unread_variables" ) {}
+ void runTest() { suite_AstTestSuite.test_dead_code_removes_unread_variables(); }
+} testDescription_suite_AstTestSuite_test_dead_code_removes_unread_variables;
+
+static class TestDescription_suite_AstTestSuite_test_dead_code_keeps_let_statements : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_dead_code_keeps_let_statements() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 385, "test_dead_code_keeps_let_statements" ) {}
+ void runTest() { suite_AstTestSuite.test_dead_code_keeps_let_statements(); }
+} testDescription_suite_AstTestSuite_test_dead_code_keeps_let_statements;
+
+static class TestDescription_suite_AstTestSuite_test_sample_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_1() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 405, "test_sample_1" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_1(); }
+} testDescription_suite_AstTestSuite_test_sample_1;
+
+static class TestDescription_suite_AstTestSuite_test_sample_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_2() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 406, "test_sample_2" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_2(); }
+} testDescription_suite_AstTestSuite_test_sample_2;
+
+static class TestDescription_suite_AstTestSuite_test_sample_3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_3() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 407, "test_sample_3" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_3(); }
+} testDescription_suite_AstTestSuite_test_sample_3;
+
+static class TestDescription_suite_AstTestSuite_test_sample_4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_4() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 408, "test_sample_4" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_4(); }
+} testDescription_suite_AstTestSuite_test_sample_4;
+
+static class TestDescription_suite_AstTestSuite_test_sample_5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_5() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 409, "test_sample_5" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_5(); }
+} testDescription_suite_AstTestSuite_test_sample_5;
+
+static class TestDescription_suite_AstTestSuite_test_mysample : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_mysample() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 410, "test_mysample" ) {}
+ void runTest() { suite_AstTestSuite.test_mysample(); }
+} testDescription_suite_AstTestSuite_test_mysample;
+
+static class TestDescription_suite_AstTestSuite_test_forest_loss : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_forest_loss() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 411, "test_forest_loss" ) {}
+ void runTest() { suite_AstTestSuite.test_forest_loss(); }
+} testDescription_suite_AstTestSuite_test_forest_loss;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
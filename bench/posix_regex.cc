@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * Name            : posix_regex.cc
+ * Project         : fcal
+ * Module          : bench
+ * Description     : This file wraps regcomp/regexec the way the scanner's
+ *                   regex module used to.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <regex.h>
+#include <cstddef>
+#include "bench/posix_regex.h"
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+struct PosixRegex {
+  regex_t re;
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+PosixRegex *make_posix_regex(const char *pattern) {
+  PosixRegex *re = new PosixRegex;
+  if (regcomp(&re->re, pattern, REG_EXTENDED) != 0) {
+    delete re;
+    return NULL;
+  }
+  return re;
+} /* make_posix_regex() */
+
+int match_posix_regex(PosixRegex *re, const char *text) {
+  regmatch_t matches[1];
+  if (regexec(&re->re, text, 1, matches, 0) == REG_NOMATCH) {
+    return 0;
+  }
+  return matches[0].rm_eo;
+} /* match_posix_regex() */
+
+void free_posix_regex(PosixRegex *re) {
+  if (re != NULL) {
+    regfree(&re->re);
+    delete re;
+  }
+} /* free_posix_regex() */
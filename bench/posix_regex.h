@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * Name            : posix_regex.h
+ * Project         : fcal
+ * Module          : bench
+ * Description     : Header file for a thin wrapper over the C library's
+ *                   regcomp/regexec, which the benchmarks compare against.
+ *                   It is kept in its own file because <regex.h> and
+ *                   include/regex.h both define regex_t.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_BENCH_POSIX_REGEX_H_
+#define PROJECT_BENCH_POSIX_REGEX_H_
+
+/*******************************************************************************
+ * Forward Declarations
+ ******************************************************************************/
+struct PosixRegex;
+
+/* Compiles [pattern] with REG_EXTENDED; returns NULL on error. */
+PosixRegex *make_posix_regex(const char *pattern);
+
+/* What match_regex() used to return: the end of the first match, or 0. */
+int match_posix_regex(PosixRegex *re, const char *text);
+
+void free_posix_regex(PosixRegex *re);
+
+#endif /* PROJECT_BENCH_POSIX_REGEX_H_ */
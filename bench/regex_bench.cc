@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Name            : regex_bench.cc
+ * Project         : fcal
+ * Module          : bench
+ * Description     : Compares match_regex() against the C library's regexec
+ *                   on the scanner's own patterns, trying every pattern at
+ *                   the start of every token, the way the scanner used to.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "include/regex.h"
+#include "include/scanner.h"
+#include "bench/posix_regex.h"
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const char *kSnippet =
+  "main () {\n"
+  "  /* sum the lower triangle */\n"
+  "  matrix m [ 10 : 10 ] i : j = i * 10 + j ;\n"
+  "  float sum ; sum = 0.0 ;\n"
+  "  repeat ( i = 0 to 9 ) {\n"
+  "    repeat ( j = 0 to i ) {\n"
+  "      sum = sum + m [ i : j ] ;  // running total\n"
+  "    }\n"
+  "  }\n"
+  "  if ( sum >= 100.5 && ! False ) { print ( \"big\" ) ; }\n"
+  "}\n";
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+namespace fs = fcal::scanner;
+typedef std::chrono::steady_clock Clock;
+
+/*
+ * Matches every pattern at every start position, [rounds] times over, and
+ * returns ns per match call. [lengths] receives the total matched length
+ * so that the two engines can be checked against each other.
+ */
+template <typename Match>
+static double time_matches(const std::vector<const char *> &starts,
+                           int num_patterns, int rounds, size_t *lengths,
+                           Match match) {
+  size_t total = 0;
+  Clock::time_point start = Clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < starts.size(); i++) {
+      for (int k = 0; k < num_patterns; k++) {
+        total += match(k, starts[i]);
+      }
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  *lengths = total / rounds;
+  return elapsed.count() /
+      (static_cast<double>(starts.size()) * num_patterns * rounds);
+}
+
+int main(int argc, char **argv) {
+  int copies = (argc > 1) ? atoi(argv[1]) : 20;
+  int rounds = (argc > 2) ? atoi(argv[2]) : 20;
+
+  std::string text;
+  for (int i = 0; i < copies; i++) {
+    text += kSnippet;
+  }
+  const char *begin = text.c_str();
+
+  // Every token start, plus every gap between tokens for the skip patterns.
+  fs::Scanner scanner;
+  fs::TokenStream tokens;
+  scanner.Tokenize(begin, text.size(), &tokens);
+  std::vector<const char *> starts;
+  for (size_t i = 0; i + 1 < tokens.size(); i++) {
+    starts.push_back(begin + tokens[i].offset);
+    starts.push_back(begin + tokens[i].offset + tokens[i].length);
+  }
+
+  std::vector<const char *> patterns;
+  for (int i = 0; i < fs::kNumTokenSpecs; i++) {
+    patterns.push_back(fs::kTokenSpecs[i].pattern);
+  }
+  for (int i = 0; i < fs::kNumSkipPatterns; i++) {
+    patterns.push_back(fs::kSkipPatterns[i]);
+  }
+  int n = static_cast<int>(patterns.size());
+
+  std::vector<regex_t *> ours(n);
+  std::vector<PosixRegex *> posix(n);
+  Clock::time_point start = Clock::now();
+  for (int k = 0; k < n; k++) {
+    ours[k] = fs::make_regex(patterns[k]);
+  }
+  std::chrono::duration<double, std::micro> ours_compile = Clock::now() - start;
+  start = Clock::now();
+  for (int k = 0; k < n; k++) {
+    posix[k] = make_posix_regex(patterns[k]);
+  }
+  std::chrono::duration<double, std::micro> posix_compile =
+      Clock::now() - start;
+
+  printf("%zu bytes, %d patterns, %zu start positions\n", text.size(), n,
+         starts.size());
+  printf("%-8s %10.1f us to compile all patterns\n", "regexec",
+         posix_compile.count());
+  printf("%-8s %10.1f us to compile all patterns\n", "lazy dfa",
+         ours_compile.count());
+
+  // The first pass over the text also fills in the lazy DFA's cache.
+  size_t posix_len, cold_len, warm_len;
+  double posix_ns = time_matches(starts, n, 1, &posix_len,
+      [&](int k, const char *at) { return match_posix_regex(posix[k], at); });
+  double cold_ns = time_matches(starts, n, 1, &cold_len,
+      [&](int k, const char *at) { return fs::match_regex(ours[k], at); });
+  double warm_ns = time_matches(starts, n, rounds, &warm_len,
+      [&](int k, const char *at) { return fs::match_regex(ours[k], at); });
+  if (posix_len != cold_len || posix_len != warm_len) {
+    fprintf(stderr, "regex_bench: engines disagree\n");
+    return 1;
+  }
+  for (size_t i = 0; i < starts.size(); i++) {
+    for (int k = 0; k < n; k++) {
+      if (fs::match_regex(ours[k], starts[i]) !=
+          match_posix_regex(posix[k], starts[i])) {
+        fprintf(stderr, "regex_bench: engines disagree on %s\n",
+                patterns[k]);
+        return 1;
+      }
+    }
+  }
+
+  printf("%-8s %10.1f ns/match\n", "regexec", posix_ns);
+  printf("%-8s %10.1f ns/match %8.1fx (first pass)\n", "lazy dfa", cold_ns,
+         posix_ns / cold_ns);
+  printf("%-8s %10.1f ns/match %8.1fx\n", "lazy dfa", warm_ns,
+         posix_ns / warm_ns);
+
+  for (int k = 0; k < n; k++) {
+    fs::free_regex(ours[k]);
+    free_posix_regex(posix[k]);
+  }
+  return 0;
+} /* main() */
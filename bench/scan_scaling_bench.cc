@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Name            : scan_scaling_bench.cc
+ * Project         : fcal
+ * Module          : bench
+ * Description     : Measures how scanning time grows with the size of the
+ *                   input, from 1 KB up to a configurable maximum. Each input
+ *                   is a buffer with no NUL terminator, scanned through the
+ *                   length-bounded Tokenize, optionally in parallel.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "include/scanner.h"
+#include "include/thread_pool.h"
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const char *kSnippet =
+  "/* accumulate a running total */\n"
+  "int total ;\n"
+  "total = 0 ;\n"
+  "repeat ( i = 1 to 100 ) {\n"
+  "    total = total + i * 2 ;  // keep going\n"
+  "}\n"
+  "float ratio ;\n"
+  "ratio = 3.14159 / 2.0 ;\n"
+  "if ( total >= 10 && ratio != 0.5 ) { print ( \"done\" ) ; }\n";
+
+// Small inputs are scanned repeatedly until at least this many bytes pass.
+static const size_t kMinBytesPerSample = 64u << 20;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+typedef std::chrono::steady_clock Clock;
+
+/* Fills [buffer] with copies of kSnippet, cut off wherever [size] ends. */
+static void fill(char *buffer, size_t size) {
+  size_t snippet_length = strlen(kSnippet);
+  for (size_t i = 0; i < size; i += snippet_length) {
+    size_t n = (size - i < snippet_length) ? size - i : snippet_length;
+    memcpy(buffer + i, kSnippet, n);
+  }
+}
+
+static void scan(fcal::scanner::Scanner *scanner, const char *buffer,
+                 size_t size, fcal::scanner::TokenStream *tokens,
+                 fcal::ThreadPool *pool) {
+  if (pool == NULL) {
+    scanner->Tokenize(buffer, size, tokens);
+  } else {
+    scanner->Tokenize(buffer, size, tokens, pool);
+  }
+}
+
+int main(int argc, char **argv) {
+  // The maximum input size in MB. 1 GB needs about 5 GB of memory for the
+  // input and its token stream.
+  size_t max_mb = (argc > 1) ? strtoul(argv[1], NULL, 10) : 256;
+  size_t max_size = max_mb << 20;
+  // With more than one thread, inputs of a MB or more are scanned in chunks.
+  int threads = (argc > 2) ? atoi(argv[2]) : 1;
+  fcal::ThreadPool pool(threads);
+
+  fcal::scanner::Scanner scanner;
+  fcal::scanner::TokenStream tokens;
+  double min_ns = 0, max_ns = 0;
+
+  printf("%12s %12s %12s %10s\n", "bytes", "tokens", "ns/byte", "MB/s");
+  for (size_t size = 1024; size <= max_size; size *= 2) {
+    // Exactly [size] bytes: the scanner must not read past the end.
+    char *buffer = static_cast<char *>(malloc(size));
+    if (buffer == NULL) {
+      fprintf(stderr, "scan_scaling_bench: out of memory at %zu bytes\n",
+              size);
+      return 1;
+    }
+    fill(buffer, size);
+
+    // One untimed pass grows the token storage, so page faults on fresh
+    // memory are not counted as scanning time.
+    scan(&scanner, buffer, size, &tokens, (threads > 1) ? &pool : NULL);
+
+    size_t repeats = kMinBytesPerSample / size + 1;
+    Clock::time_point start = Clock::now();
+    for (size_t r = 0; r < repeats; r++) {
+      scan(&scanner, buffer, size, &tokens, (threads > 1) ? &pool : NULL);
+    }
+    std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    double ns_per_byte = elapsed.count() / (static_cast<double>(size) *
+                                            repeats);
+
+    printf("%12zu %12zu %12.3f %10.1f\n", size, tokens.size(), ns_per_byte,
+           1e3 / ns_per_byte);
+    if (min_ns == 0 || ns_per_byte < min_ns) {
+      min_ns = ns_per_byte;
+    }
+    if (ns_per_byte > max_ns) {
+      max_ns = ns_per_byte;
+    }
+    free(buffer);
+  } /* for() */
+
+  // Linear time means a flat ns/byte column; report how far it strays.
+  printf("ns/byte spread (max/min): %.2f\n", max_ns / min_ns);
+  return 0;
+} /* main() */
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Name            : skip_bench.cc
+ * Project         : fcal
+ * Module          : bench
+ * Description     : Compares the ways of skipping whitespace and comments
+ *                   between tokens: the original loop over three POSIX
+ *                   regexes, the generated skip DFA, and the scalar and
+ *                   vector skippers, on heavily indented and commented
+ *                   input.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "include/dfa.h"
+#include "include/scanner.h"
+#include "include/skip.h"
+#include "bench/posix_regex.h"
+#include "lexer_tables.h"
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const char *kSnippet =
+  "        /* Walk the rows of the matrix and accumulate the sum of the\n"
+  "         * entries on and below the diagonal. */\n"
+  "        repeat ( i = 0 to n ) {\n"
+  "            // only the lower triangle\n"
+  "            repeat ( j = 0 to i ) {\n"
+  "                sum = sum + m [ i : j ] ;   // running total\n"
+  "            }\n"
+  "        }\n"
+  "\n";
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+namespace fs = fcal::scanner;
+typedef std::chrono::steady_clock Clock;
+
+/* The skipper as it was: whitespace, block and line comment regexes in turn.
+   The text must be NUL-terminated. */
+static size_t skip_regex(PosixRegex *const *re, const char *text) {
+  size_t total = 0;
+  bool consumed;
+  do {
+    consumed = false;
+    for (int i = 0; i < fs::kNumSkipPatterns; i++) {
+      int n = match_posix_regex(re[i], text + total);
+      if (n > 0) {
+        total += n;
+        consumed = true;
+      }
+    }
+  } while (consumed);
+  return total;
+}
+
+static size_t skip_dfa(const char *text, const char *end) {
+  size_t total = 0;
+  size_t n;
+  int tag;
+  while ((n = fs::dfa_match(fs::kSkipDfa, text + total, end, &tag)) > 0) {
+    total += n;
+  }
+  return total;
+}
+
+/* Skips at every gap between tokens, [rounds] times over; returns ns/gap. */
+template <typename Skip>
+static double time_gaps(const std::vector<size_t> &gaps, int rounds,
+                        size_t expected, Skip skip) {
+  size_t skipped = 0;
+  Clock::time_point start = Clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < gaps.size(); i++) {
+      skipped += skip(gaps[i]);
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  if (skipped != expected * rounds) {
+    fprintf(stderr, "skip_bench: implementations disagree\n");
+    exit(1);
+  }
+  return elapsed.count() / (static_cast<double>(gaps.size()) * rounds);
+}
+
+int main(int argc, char **argv) {
+  int copies = (argc > 1) ? atoi(argv[1]) : 2000;
+  int rounds = (argc > 2) ? atoi(argv[2]) : 20;
+
+  std::string text;
+  for (int i = 0; i < copies; i++) {
+    text += kSnippet;
+  }
+  const char *begin = text.c_str();
+  const char *end = begin + text.size();
+
+  // Every skip starts where a token ends (or at the start of the text).
+  fs::Scanner scanner;
+  fs::TokenStream tokens;
+  scanner.Tokenize(begin, text.size(), &tokens);
+  std::vector<size_t> gaps(1, 0);
+  for (size_t i = 0; i + 1 < tokens.size(); i++) {
+    gaps.push_back(tokens[i].offset + tokens[i].length);
+  }
+  size_t expected = 0;
+  for (size_t i = 0; i < gaps.size(); i++) {
+    expected += skip_dfa(begin + gaps[i], end);
+  }
+  printf("%zu bytes, %zu gaps, %.1f%% of the text skipped\n", text.size(),
+         gaps.size(), 100.0 * expected / text.size());
+
+  PosixRegex *re[3];
+  for (int i = 0; i < fs::kNumSkipPatterns; i++) {
+    re[i] = make_posix_regex(fs::kSkipPatterns[i]);
+  }
+  double regex_ns = time_gaps(gaps, 1, expected, [&](size_t at) {
+    return skip_regex(re, begin + at);
+  });
+  printf("%-8s %10.1f ns/gap\n", "regex", regex_ns);
+  for (int i = 0; i < fs::kNumSkipPatterns; i++) {
+    free_posix_regex(re[i]);
+  }
+
+  double dfa_ns = time_gaps(gaps, rounds, expected, [&](size_t at) {
+    return skip_dfa(begin + at, end);
+  });
+  printf("%-8s %10.1f ns/gap %8.1fx\n", "dfa", dfa_ns, regex_ns / dfa_ns);
+
+  const char *names[fs::kNumSkipImpls] = { "scalar", "sse2", "avx2" };
+  for (int i = 0; i < fs::kNumSkipImpls; i++) {
+    fs::SkipImpl impl = static_cast<fs::SkipImpl>(i);
+    if (!fs::skip_impl_supported(impl)) {
+      printf("%-8s   (not supported on this CPU)\n", names[i]);
+      continue;
+    }
+    double ns = time_gaps(gaps, rounds, expected, [&](size_t at) {
+      return fs::skip_whitespace_and_comments(begin + at, end, impl);
+    });
+    printf("%-8s %10.1f ns/gap %8.1fx\n", names[i], ns, regex_ns / ns);
+  }
+  return 0;
+} /* main() */
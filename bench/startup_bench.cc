@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Name            : startup_bench.cc
+ * Project         : fcal
+ * Module          : bench
+ * Description     : Measures the fixed cost of setting up a Scanner and a
+ *                   Parser, which dominates when translating many small
+ *                   programs.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "include/parser.h"
+#include "include/scanner.h"
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const char *kTinyProgram = "main () { int x; x = 1 + 2; print(x); }";
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+typedef std::chrono::steady_clock Clock;
+
+static double micros_since(Clock::time_point start, int iterations) {
+  std::chrono::duration<double, std::micro> elapsed = Clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+int main(int argc, char **argv) {
+  int iterations = (argc > 1) ? atoi(argv[1]) : 20000;
+  fcal::scanner::Token *tokens = NULL;
+
+  // What every Scanner constructor used to pay: compiling all the patterns.
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < iterations / 100 + 1; i++) {
+    fcal::scanner::Scanner s;
+    s.init_regex();
+  }
+  double regex_setup = micros_since(start, iterations / 100 + 1);
+
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    fcal::scanner::Scanner s;
+    tokens = s.Scan("");
+    delete tokens;
+  }
+  double scanner_setup = micros_since(start, iterations);
+
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    fcal::parser::Parser p;
+    if (!p.Parse(kTinyProgram).ok()) {
+      fprintf(stderr, "startup_bench: parse failed\n");
+      return 1;
+    }
+  }
+  double parse = micros_since(start, iterations);
+
+  printf("init_regex (old per-Scanner setup) : %10.3f us\n", regex_setup);
+  printf("Scanner + Scan(\"\")                 : %10.3f us\n", scanner_setup);
+  printf("Parser + Parse(tiny program)       : %10.3f us\n", parse);
+  return 0;
+} /* main() */
@@ -0,0 +1,93 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_CodeGenTestSuite_init = false;
+#include "/root/repo/tests/codegeneration_tests.h"
+
+static CodeGenTestSuite suite_CodeGenTestSuite;
+
+static CxxTest::List Tests_CodeGenTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CodeGenTestSuite( "tests/codegeneration_tests.h", 22, "CodeGenTestSuite", suite_CodeGenTestSuite, Tests_CodeGenTestSuite );
+
+static class TestDescription_suite_CodeGenTestSuite_test_not_expr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_not_expr() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 123, "test_not_expr" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_not_expr(); }
+} testDescription_suite_CodeGenTestSuite_test_not_expr;
+
+static class TestDescription_suite_CodeGenTestSuite_test_matrix_multiply : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_matrix_multiply() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 131, "test_matrix_multiply" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_matrix_multiply(); }
+} testDescription_suite_CodeGenTestSuite_test_matrix_multiply;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_1() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 141, "test_sample_1" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_1(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_1;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_2() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 142, "test_sample_2" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_2(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_2;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_3() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 143, "test_sample_3" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_3(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_3;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 144, "test_sample_7" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_8() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 145, "test_sample_8" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_8(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_8;
+
+static class TestDescription_suite_CodeGenTestSuite_test_your_code_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_your_code_1() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 151, "test_your_code_1" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_your_code_1(); }
+} testDescription_suite_CodeGenTestSuite_test_your_code_1;
+
+static class TestDescription_suite_CodeGenTestSuite_test_your_code_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_your_code_2() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 152, "test_your_code_2" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_your_code_2(); }
+} testDescription_suite_CodeGenTestSuite_test_your_code_2;
+
+static class TestDescription_suite_CodeGenTestSuite_test_forest_loss : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_forest_loss() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 154, "test_forest_loss" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_forest_loss(); }
+} testDescription_suite_CodeGenTestSuite_test_forest_loss;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
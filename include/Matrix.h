@@ -32,6 +32,10 @@ class matrix {
 
     static matrix matrix_read(std::string filename);
 
+    /* The product of a and b, summed in single precision. Generated code
+       calls this directly when it knows both operands are matrices. */
+    static matrix multiply(const matrix &a, const matrix &b);
+
     ~matrix();
 
  private:
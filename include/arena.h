@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Name            : arena.h
+ * Project         : fcal
+ * Module          : util
+ * Description     : Header file for a bump-pointer arena that owns every
+ *                   object allocated from it and frees them all at once.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_ARENA_H_
+#define PROJECT_INCLUDE_ARENA_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* Size of each block the arena carves objects out of. */
+const size_t kArenaBlockSize = 16 * 1024;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Arena
+ * Hands out memory by bumping a pointer through large blocks, so objects
+ * allocated one after another sit next to each other. Nothing is freed on
+ * its own: Reset() runs the destructors of every object made with New(), in
+ * reverse order, and rewinds the arena so that its blocks are used again.
+ * Release(), or destroying the arena, also gives the blocks back.
+ *
+ * Not thread-safe; give each thread its own arena.
+ */
+class Arena {
+ public:
+  Arena(void) : blocks_(), large_(), next_block_(0), ptr_(NULL), end_(NULL),
+                cleanups_(NULL), bytes_(0) {}
+  ~Arena(void) { Release(); }
+
+  /*
+   * Constructs a T in the arena. Its destructor runs when the arena is
+   * reset, unless T has nothing to destroy.
+   */
+  template <typename T, typename... Args>
+  T *New(Args&&... args) {
+    if (std::is_trivially_destructible<T>::value) {
+      return new (Allocate(sizeof(T), alignof(T)))
+          T(std::forward<Args>(args)...);
+    }
+    Cleanup *cleanup = static_cast<Cleanup *>(
+        Allocate(sizeof(Cleanup), alignof(Cleanup)));
+    T *object = new (Allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+    cleanup->destroy = &Destroy<T>;
+    cleanup->object = object;
+    cleanup->next = cleanups_;
+    cleanups_ = cleanup;
+    return object;
+  }
+
+  /* Returns [size] bytes aligned to [align], a power of two. */
+  void *Allocate(size_t size, size_t align) {
+    uintptr_t at = (reinterpret_cast<uintptr_t>(ptr_) + align - 1) &
+        ~static_cast<uintptr_t>(align - 1);
+    if (ptr_ == NULL || at + size > reinterpret_cast<uintptr_t>(end_)) {
+      return AllocateSlow(size, align);
+    }
+    ptr_ = reinterpret_cast<char *>(at + size);
+    bytes_ += size;
+    return reinterpret_cast<void *>(at);
+  }
+
+  /*
+   * Destroys everything allocated so far. The blocks are kept for reuse,
+   * except those that were made for a single oversized allocation.
+   */
+  void Reset(void);
+
+  /* Destroys everything allocated so far and frees all the memory. */
+  void Release(void);
+
+  /* Bytes handed out since the last Reset(). */
+  size_t bytes_allocated(void) const { return bytes_; }
+  /* Blocks held, whether in use or kept from before the last Reset(). */
+  size_t num_blocks(void) const { return blocks_.size() + large_.size(); }
+
+ private:
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  struct Cleanup {
+    void (*destroy)(void *object);
+    void *object;
+    Cleanup *next;
+  };
+
+  template <typename T>
+  static void Destroy(void *object) { static_cast<T *>(object)->~T(); }
+
+  void *AllocateSlow(size_t size, size_t align);
+
+  /* Blocks of kArenaBlockSize, used in order; next_block_ is the next one
+     to move to when the current block fills up */
+  std::vector<char *> blocks_;
+  std::vector<char *> large_;
+  size_t next_block_;
+  char *ptr_;
+  char *end_;
+  Cleanup *cleanups_;
+  size_t bytes_;
+};
+
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_ARENA_H_ */
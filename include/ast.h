@@ -14,10 +14,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <stddef.h>
 #include <iostream>
 #include <string>
 #include <typeinfo>
+#include "./emitter.h"
 #include "./scanner.h"
+#include "./symbol_table.h"
 
 /*******************************************************************************
  * Namespaces
@@ -25,28 +28,93 @@
 namespace fcal {
 namespace ast {
 
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/*
+ * Every concrete class of node, with the class it derives from. Passes that
+ * have to handle each kind of node expand this list rather than repeat it.
+ */
+#define FCAL_AST_NODES(X)                                                     \
+  X(VarExpr, Expr) X(IntConstExpr, Expr) X(FloatConstExpr, Expr)              \
+  X(StringConstExpr, Expr) X(TrueExpr, Expr) X(FalseExpr, Expr)               \
+  X(MulExpr, Expr) X(DivExpr, Expr) X(PlusExpr, Expr) X(MinusExpr, Expr)      \
+  X(GreaterExpr, Expr) X(GreaterEqualExpr, Expr) X(LessExpr, Expr)            \
+  X(LessEqualExpr, Expr) X(EqualEqualExpr, Expr) X(NotEqualExpr, Expr)        \
+  X(AndExpr, Expr) X(OrExpr, Expr) X(MatrixRefExpr, Expr)                     \
+  X(FuncCallExpr, Expr) X(GroupExpr, Expr) X(IfExpr, Expr) X(NotExpr, Expr)   \
+  X(LetExpr, Expr) X(IntDecl, Decl) X(FloatDecl, Decl) X(StringDecl, Decl)    \
+  X(BooleanDecl, Decl) X(ShortMatrixDecl, Decl) X(LongMatrixDecl, Decl)       \
+  X(DeclStmt, Stmt) X(BlockStmt, Stmt) X(IfStmt, Stmt) X(IfElseStmt, Stmt)    \
+  X(AssignStmt, Stmt) X(MatrixAssignStmt, Stmt) X(PrintStmt, Stmt)            \
+  X(RepeatStmt, Stmt) X(WhileStmt, Stmt) X(EmptyStmt, Stmt) X(Stmts, Node)    \
+  X(Program, Node)
+
+/* What a node is, so that passes can dispatch on it without virtuals. */
+enum NodeKind {
+#define FCAL_AST_NODE_KIND(name, base) k##name,
+  FCAL_AST_NODES(FCAL_AST_NODE_KIND)
+#undef FCAL_AST_NODE_KIND
+  kNumNodeKinds
+};
+
+/* The type of an expression, as the TypeChecker (type_checker.h) finds it. */
+enum Type {
+  kNoType,      /* not checked yet, or ill-typed */
+  kIntType,
+  kFloatType,
+  kBoolType,
+  kStringType,
+  kMatrixType
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
 /*!
  * Node (Abstract)
- * The interface of all ast classes. All inheriting classes have to implement
- * UnParse method.
+ * The interface of all ast classes. Each node records its kind, which the
+ * visitors in visitor.h switch on to reach the concrete class; UnParse() and
+ * CppCode() return the text of the whole subtree, as written by the
+ * visitors in emitter.cc.
  */
 class Node {
  public:
-  virtual std::string UnParse(void) { return " This should be pure virtual "; }
-  virtual std::string CppCode(void) { return " This should be pure virtual"; }
+  NodeKind kind(void) const { return kind_; }
+  std::string UnParse(void) {
+    std::string text;
+    Emitter(&text).Emit(this, kFcal);
+    return text;
+  }
+  std::string CppCode(void) {
+    std::string text;
+    Emitter(&text).Emit(this, kCpp);
+    return text;
+  }
   virtual ~Node(void) {}
+
+ protected:
+  explicit Node(NodeKind kind) : kind_(kind) {}
+
+ private:
+  NodeKind kind_;
 };
 
 /*!
  * Expr (Abstract)
- * This class is the abstract class of all Expr type classes.
+ * This class is the abstract class of all Expr type classes. Each one has
+ * the type the TypeChecker gave it, which code generation specializes on.
  */
 class Expr : public Node {
  public:
-    virtual std::string UnParse(void) {return " This should be pure virtual ";}
+  Type type(void) const { return type_; }
+  void set_type(Type type) { type_ = type; }
+
+ protected:
+  explicit Expr(NodeKind kind) : Node(kind), type_(kNoType) {}
+
+ private:
+  Type type_;
 };
 
 /*!
@@ -55,14 +123,12 @@ class Expr : public Node {
  */
 class VarExpr : public Expr {
  public:
-    explicit VarExpr(std::string s) { name_ = s; }
-    std::string name() { return name_; }
-    void set_name(std::string s) { name_ = s; }
-    std::string UnParse(void) { return name_; }
-    std::string CppCode(void) { return name_; }
+    explicit VarExpr(Symbol s) : Expr(kVarExpr) { name_ = s; }
+    Symbol name() { return name_; }
+    void set_name(Symbol s) { name_ = s; }
 
  private:
-    std::string name_;
+    Symbol name_;
 };
 
 /*!
@@ -71,11 +137,9 @@ class VarExpr : public Expr {
  */
 class IntConstExpr : public Expr {
  public:
-    explicit IntConstExpr(std::string s) { value_ = s; }
-    std::string value() { return value_ ;}
+    explicit IntConstExpr(std::string s) : Expr(kIntConstExpr) { value_ = s; }
+    const std::string &value() { return value_; }
     void set_value(std::string s) { value_ = s; }
-    std::string UnParse(void) { return value_; }
-    std::string CppCode(void) { return value_; }
 
  private:
     std::string value_;
@@ -87,11 +151,10 @@ class IntConstExpr : public Expr {
  */
 class FloatConstExpr : public Expr {
  public:
-    explicit FloatConstExpr(std::string s) { value_ = s; }
-    std::string value() { return value_; }
+    explicit FloatConstExpr(std::string s)
+        : Expr(kFloatConstExpr) { value_ = s; }
+    const std::string &value() { return value_; }
     void set_value(std::string s) { value_ = s; }
-    std::string UnParse(void) { return value_; }
-    std::string CppCode(void) { return value_; }
 
  private:
     std::string value_;
@@ -103,11 +166,10 @@ class FloatConstExpr : public Expr {
  */
 class StringConstExpr : public Expr {
  public:
-    explicit StringConstExpr(std::string s) { value_ = s; }
-    std::string value() { return value_; }
+    explicit StringConstExpr(std::string s)
+        : Expr(kStringConstExpr) { value_ = s; }
+    const std::string &value() { return value_; }
     void set_value(std::string s) { value_ = s; }
-    std::string UnParse(void) { return value_; }
-    std::string CppCode(void) { return value_; }
 
  private:
     std::string value_;
@@ -119,9 +181,7 @@ class StringConstExpr : public Expr {
  */
 class TrueExpr : public Expr {
  public:
-    TrueExpr() {}
-    std::string UnParse() { return "True"; }
-    std::string CppCode(void) { return "true"; }
+    TrueExpr() : Expr(kTrueExpr) {}
 };
 
 /*!
@@ -130,9 +190,7 @@ class TrueExpr : public Expr {
  */
 class FalseExpr : public Expr {
  public:
-    FalseExpr() {}
-    std::string UnParse() { return "False"; }
-    std::string CppCode(void) { return "false"; }
+    FalseExpr() : Expr(kFalseExpr) {}
 };
 
 /*!
@@ -141,15 +199,12 @@ class FalseExpr : public Expr {
  */
 class MulExpr : public Expr {
  public:
-    MulExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    MulExpr(Expr* l, Expr* r)
+        : Expr(kMulExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " * " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " * " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -162,15 +217,12 @@ class MulExpr : public Expr {
  */
 class DivExpr : public Expr {
  public:
-    DivExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    DivExpr(Expr* l, Expr* r)
+        : Expr(kDivExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " / " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " / " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -183,15 +235,12 @@ class DivExpr : public Expr {
  */
 class PlusExpr : public Expr {
  public:
-    PlusExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    PlusExpr(Expr* l, Expr* r)
+        : Expr(kPlusExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " + " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " + " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -204,15 +253,12 @@ class PlusExpr : public Expr {
  */
 class MinusExpr : public Expr {
  public:
-    MinusExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    MinusExpr(Expr* l, Expr* r)
+        : Expr(kMinusExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " - " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " - " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -225,15 +271,12 @@ class MinusExpr : public Expr {
  */
 class GreaterExpr : public Expr {
  public:
-    GreaterExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    GreaterExpr(Expr* l, Expr* r)
+        : Expr(kGreaterExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " > " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " > " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -246,15 +289,12 @@ class GreaterExpr : public Expr {
  */
 class GreaterEqualExpr : public Expr {
  public:
-    GreaterEqualExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    GreaterEqualExpr(Expr* l, Expr* r)
+        : Expr(kGreaterEqualExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " >= " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " >= " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -267,15 +307,12 @@ class GreaterEqualExpr : public Expr {
  */
 class LessExpr : public Expr {
  public:
-    LessExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    LessExpr(Expr* l, Expr* r)
+        : Expr(kLessExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " < " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "( " + expr_left_->CppCode() + " < " \
-        + expr_right_->CppCode() + " )"; }
 
  private:
     Expr* expr_left_;
@@ -288,15 +325,12 @@ class LessExpr : public Expr {
  */
 class LessEqualExpr : public Expr {
  public:
-    LessEqualExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    LessEqualExpr(Expr* l, Expr* r)
+        : Expr(kLessEqualExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " <= " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return "(" + expr_left_->CppCode() + " <= " \
-        + expr_right_->CppCode() + ")"; }
 
  private:
     Expr* expr_left_;
@@ -309,15 +343,12 @@ class LessEqualExpr : public Expr {
  */
 class EqualEqualExpr : public Expr {
  public:
-    EqualEqualExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    EqualEqualExpr(Expr* l, Expr* r)
+        : Expr(kEqualEqualExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " == " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return expr_left_->CppCode() + " == " \
-        + expr_right_->CppCode(); }
 
  private:
     Expr* expr_left_;
@@ -330,15 +361,12 @@ class EqualEqualExpr : public Expr {
  */
 class NotEqualExpr : public Expr {
  public:
-    NotEqualExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    NotEqualExpr(Expr* l, Expr* r)
+        : Expr(kNotEqualExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " != " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return expr_left_->CppCode() + " != " \
-        + expr_right_->CppCode(); }
 
  private:
     Expr* expr_left_;
@@ -351,15 +379,12 @@ class NotEqualExpr : public Expr {
  */
 class AndExpr : public Expr {
  public:
-    AndExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    AndExpr(Expr* l, Expr* r)
+        : Expr(kAndExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " && " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return expr_left_->CppCode() + " && " \
-        + expr_right_->CppCode(); }
  private:
     Expr* expr_left_;
     Expr* expr_right_;
@@ -371,15 +396,12 @@ class AndExpr : public Expr {
  */
 class OrExpr : public Expr {
  public:
-    OrExpr(Expr* l, Expr* r) { expr_left_ = l; expr_right_ = r; }
+    OrExpr(Expr* l, Expr* r)
+        : Expr(kOrExpr) { expr_left_ = l; expr_right_ = r; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
     void set_expr_right(Expr* r) { expr_right_ = r; }
-    std::string UnParse() { return expr_left_->UnParse() + " || " \
-        + expr_right_->UnParse(); }
-    std::string CppCode() { return expr_left_->CppCode() + " || " \
-        + expr_right_->CppCode(); }
 
  private:
     Expr* expr_left_;
@@ -392,28 +414,20 @@ class OrExpr : public Expr {
  */
 class MatrixRefExpr : public Expr {
  public:
-    MatrixRefExpr(std::string n, Expr* l, Expr* r) {
+    MatrixRefExpr(Symbol n, Expr* l, Expr* r) : Expr(kMatrixRefExpr) {
         name_ = n;
         expr_left_ = l;
         expr_right_ = r;
     }
-    std::string name() { return name_; }
-    void set_name(std::string n) { name_ = n; }
+    Symbol name() { return name_; }
+    void set_name(Symbol n) { name_ = n; }
     Expr* expr_left() { return expr_left_; }
     void set_expr_left(Expr* l) { expr_left_ = l; }
     Expr* expr_right() { return expr_right_; }
-    void set_expr_right(Expr* r) { expr_left_ = r; }
-    std::string UnParse() {
-        return name_ + " [" + expr_left_->UnParse() + ": " \
-            + expr_right_->UnParse() + "]"; }
-
-    std::string CppCode(void) {
-      return "*(" + name_ + ".access(" + expr_left_->CppCode() + ", " +\
-        expr_right_->CppCode() + "))";
-    }
+    void set_expr_right(Expr* r) { expr_right_ = r; }
 
  private:
-    std::string name_;
+    Symbol name_;
     Expr* expr_left_;
     Expr* expr_right_;
 };
@@ -424,25 +438,15 @@ class MatrixRefExpr : public Expr {
  */
 class FuncCallExpr : public Expr {
  public:
-    FuncCallExpr(std::string n, Expr* e) { name_ = n; expr_ = e; }
-    std::string name() { return name_; }
-    void set_name(std::string n) { name_ = n; }
+    FuncCallExpr(Symbol n, Expr* e)
+        : Expr(kFuncCallExpr) { name_ = n; expr_ = e; }
+    Symbol name() { return name_; }
+    void set_name(Symbol n) { name_ = n; }
     Expr* expr() { return expr_; }
     void set_expr(Expr* e) { expr_ = e; }
-    std::string UnParse() { return name_ + "(" + expr_->UnParse() + ")"; }
-    // std::string CppCode() { return name_ + "(" + expr_->UnParse() + ")"; }
-    std::string CppCode() {
-      if (name_.compare("n_rows") == 0 || name_.compare("n_cols") == 0) {
-        return expr_->CppCode() + "." + name_ + "()";
-      } else if (name_.compare("matrix_read") == 0) {
-        return "matrix::" + name_ + "(" + expr_->CppCode() + ")";
-      } else {
-        return name_ + "(" + expr_->CppCode() + ")";
-      }
-    }
 
  private:
-    std::string name_;
+    Symbol name_;
     Expr* expr_;
 };
 
@@ -452,24 +456,21 @@ class FuncCallExpr : public Expr {
  */
 class GroupExpr : public Expr {
  public:
-    explicit GroupExpr(Expr* e) { expr_ = e; }
+    explicit GroupExpr(Expr* e) : Expr(kGroupExpr) { expr_ = e; }
     Expr* expr() { return expr_; }
     void set_expr(Expr* e) { expr_ = e; }
-    std::string UnParse() { return "(" + expr_->UnParse() + ")"; }
-    std::string CppCode() { return "(" + expr_->CppCode() + ")"; }
 
  private:
     Expr* expr_;
 };
 
-
 /*!
  * Expr ::= 'if' Expr 'then' Expr 'else' Expr
  * This class is the representation of if expression.
  */
 class IfExpr : public Expr {
  public:
-    IfExpr(Expr* e, Expr* et, Expr* ee) {
+    IfExpr(Expr* e, Expr* et, Expr* ee) : Expr(kIfExpr) {
         expr_test_ = e;
         expr_then_ = et;
         expr_else_ = ee;
@@ -480,14 +481,6 @@ class IfExpr : public Expr {
     void set_expr_then(Expr* e) { expr_then_ = e; }
     Expr* expr_else() { return expr_else_; }
     void set_expr_else(Expr* e) { expr_else_ = e; }
-    std::string UnParse() {
-        return "if " + expr_test_->UnParse() + " then " + \
-        expr_then_->UnParse() + " else " + expr_else_->UnParse();
-    }
-    std::string CppCode() {
-      return "( " + expr_test_->CppCode() + " ? " + expr_then_->CppCode() +\
-        + " : " + expr_else_->CppCode() + ")\n";
-    }
 
  private:
     Expr* expr_test_;
@@ -501,11 +494,9 @@ class IfExpr : public Expr {
  */
 class NotExpr : public Expr {
  public:
-    explicit NotExpr(Expr* e) { expr_ = e; }
+    explicit NotExpr(Expr* e) : Expr(kNotExpr) { expr_ = e; }
     Expr* expr() { return expr_; }
     void set_expr(Expr* e) { expr_ = e; }
-    std::string UnParse() { return "!" + expr_->UnParse(); }
-    std::string CppCode() { return "!" + expr_->UnParse(); }
 
  private:
     Expr* expr_;
@@ -516,8 +507,8 @@ class NotExpr : public Expr {
  * This is the abstract class for all Decl type classes.
  */
 class Decl : public Node {
- public:
-  virtual std::string UnParse(void) { return "This should be pure virtual"; }
+ protected:
+  explicit Decl(NodeKind kind) : Node(kind) {}
 };
 
 /*!
@@ -526,14 +517,12 @@ class Decl : public Node {
  */
 class IntDecl : public Decl {
  public:
-  explicit IntDecl(std::string s) { name_ = s; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
-  std::string UnParse(void) { return "int " + name_ + ";\n"; }
-  std::string CppCode(void) { return "int " + name_ + ";\n"; }
+  explicit IntDecl(Symbol s) : Decl(kIntDecl) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
 
  private:
-  std::string name_;
+  Symbol name_;
 };
 
 /*!
@@ -542,14 +531,12 @@ class IntDecl : public Decl {
  */
 class FloatDecl : public Decl {
  public:
-  explicit FloatDecl(std::string s) { name_ = s; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
-  std::string UnParse(void) { return "float " + name_ + ";\n"; }
-  std::string CppCode(void) { return "float " + name_ + ";\n"; }
+  explicit FloatDecl(Symbol s) : Decl(kFloatDecl) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
 
  private:
-  std::string name_;
+  Symbol name_;
 };
 
 /*!
@@ -558,14 +545,12 @@ class FloatDecl : public Decl {
  */
 class StringDecl : public Decl {
  public:
-  explicit StringDecl(std::string s) { name_ = s; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
-  std::string UnParse(void) { return "string " + name_ + ";\n"; }
-  std::string CppCode(void) { return "string " + name_ + ";\n"; }
+  explicit StringDecl(Symbol s) : Decl(kStringDecl) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
 
  private:
-  std::string name_;
+  Symbol name_;
 };
 
 /*!
@@ -574,14 +559,12 @@ class StringDecl : public Decl {
  */
 class BooleanDecl : public Decl {
  public:
-  explicit BooleanDecl(std::string s) { name_ = s; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
-  std::string UnParse(void) { return "boolean " + name_ + ";\n"; }
-  std::string CppCode(void) { return "boolean " + name_ + ";\n"; }
+  explicit BooleanDecl(Symbol s) : Decl(kBooleanDecl) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
 
  private:
-  std::string name_;
+  Symbol name_;
 };
 
 /*!
@@ -590,27 +573,15 @@ class BooleanDecl : public Decl {
  */
 class ShortMatrixDecl : public Decl {
  public:
-  ShortMatrixDecl(std::string s, Expr* expr) { name_ = s; expr_ = expr; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
+  ShortMatrixDecl(Symbol s, Expr* expr)
+      : Decl(kShortMatrixDecl) { name_ = s; expr_ = expr; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Expr* expr(void) { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
-  std::string UnParse(void) { return "matrix " + name_ + " = " + \
-                                expr_->UnParse() + ";\n"; }
-  std::string CppCode(void) {
-  //   FuncCallExpr* call;
-  //   MulExpr* mul;
-  //   if ((typeid(call) == typeid(expr_))) {
-  //     // calling matrx::matrxread()
-  //     return "matrix " + name_ + " = matrix::" + expr_->CppCode() + ";\n";
-  //   } else {
-  //     return "matrix " + name_ + " = " + expr_->CppCode() + ";\n";
-  //   }
-    return "matrix " + name_ + " = " + expr_->CppCode() + ";\n";
-  }
 
  private:
-  std::string name_;
+  Symbol name_;
   Expr* expr_;
 };
 
@@ -621,123 +592,87 @@ class ShortMatrixDecl : public Decl {
  */
 class LongMatrixDecl : public Decl {
  public:
-  LongMatrixDecl(std::string s, Expr* left, Expr* right, std::string l_name,
-                  std::string r_name, Expr* expr) {
+  LongMatrixDecl(Symbol s, Expr* left, Expr* right, Symbol l_name,
+                  Symbol r_name, Expr* expr) : Decl(kLongMatrixDecl) {
                     name_ = s; expr_left_ = left; expr_right_ = right;
                     name_left_ = l_name; name_right_ = r_name; expr_ = expr;
                   }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Expr* expr_left() { return expr_left_; }
   void set_expr_left(Expr* l) { expr_left_ = l; }
   Expr* expr_right() { return expr_right_; }
   void set_expr_right(Expr* r) { expr_right_ = r; }
-  std::string name_left() { return name_left_; }
-  void set_name_left(std::string s) { name_left_ = s; }
-  std::string name_right() { return name_right_; }
-  void set_name_right(std::string s) { name_right_ = s; }
+  Symbol name_left() { return name_left_; }
+  void set_name_left(Symbol s) { name_left_ = s; }
+  Symbol name_right() { return name_right_; }
+  void set_name_right(Symbol s) { name_right_ = s; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
 
-  std::string UnParse(void) { return "matrix " + name_ + " [ " + \
-        expr_left_->UnParse() + " : " + expr_right_->UnParse() + " ] " + \
-        name_left_ + " : " + name_right_ + " = " + expr_->UnParse() + ";\n";}
-
-  std::string CppCode(void) {
-    return "matrix " + name_ + "( " + expr_left_->CppCode() + ", " +\
-    expr_right_->CppCode() + " );\nfor (int " + name_left_ + " = 0; " +\
-    name_left_ + " < " + expr_left_->CppCode() + "; " +\
-    name_left_+" ++) {\n  for (int " + name_right_ + " = 0; "+\
-    name_right_+" < " + expr_right_->CppCode() + "; "+ name_right_ +\
-    " ++ ) {\n     *(" + name_ + ".access("+name_left_+", "+name_right_+\
-    ")) = "+ expr_->CppCode() +";\n  }\n}\n"; }
-
  private:
-  std::string name_;
+  Symbol name_;
   Expr* expr_left_;
   Expr* expr_right_;
-  std::string name_left_;
-  std::string name_right_;
+  Symbol name_left_;
+  Symbol name_right_;
   Expr* expr_;
 };
 
-/*!
- * Stmts (Abstract)
- * This is the abstract for all Stmts type classes.
- */
-class Stmts : public Node {
- public:
-  virtual std::string UnParse(void) { return "This should be pure virtual";}
-};
-
-/*!
- * Stmts ::= << empty >>
- * This class is the representation of empty statements.
- */
-class EmptyStmts : public Stmts {
- public:
-  EmptyStmts(void) {}
-  std::string UnParse(void) { return ""; }
-  std::string CppCode(void) { return ""; }
-};
-
 /*!
  * Stmt (Abstract)
  * This is the abstract for all Stmt type classes.
  */
 class Stmt : public Node {
- public:
-  virtual std::string UnParse(void) { return "This should be pure virtual";}
+ protected:
+  explicit Stmt(NodeKind kind) : Node(kind) {}
 };
 
 /*!
- * Stmts ::= Stmt Stmts
- * This class is the representation of multiple statements.
+ * Stmts ::= << empty >> | Stmt Stmts
+ * This class is the representation of a sequence of statements. They are
+ * kept in one array, which the parser allocates with the rest of the tree,
+ * so a sequence of any length is walked by a loop rather than recursion.
  */
-class MultiStmts : public Stmts {
+class Stmts : public Node {
  public:
-  MultiStmts(Stmt* s, Stmts* ss) { stmt_ = s, stmts_ = ss; }
-  Stmt* stmt() { return stmt_; }
-  void set_stmt(Stmt* s) { stmt_ = s; }
-  Stmts* stmts() { return stmts_; }
-  void set_stmts(Stmts* ss) { stmts_ = ss; }
-  std::string UnParse(void) { return stmt_->UnParse() + stmts_->UnParse(); }
-  std::string CppCode(void) { return stmt_->CppCode() + stmts_->CppCode(); }
+  Stmts(Stmt** stmts, size_t size)
+      : Node(kStmts) { stmts_ = stmts; size_ = size; }
+  size_t size() { return size_; }
+  Stmt* stmt(size_t i) { return stmts_[i]; }
+  void set_stmt(size_t i, Stmt* s) { stmts_[i] = s; }
+  Stmt** begin() { return stmts_; }
+  Stmt** end() { return stmts_ + size_; }
+  void set_stmts(Stmt** stmts, size_t size) { stmts_ = stmts; size_ = size; }
 
  private:
-  Stmt* stmt_;
-  Stmts* stmts_;
+  Stmt** stmts_;
+  size_t size_;
 };
 
-
 /*!
  * Stmt ::= Decl
  * This class is the representation of decleration statement.
  */
 class DeclStmt : public Stmt {
  public:
-  explicit DeclStmt(Decl* d) { decl_ = d;}
+  explicit DeclStmt(Decl* d) : Stmt(kDeclStmt) { decl_ = d;}
   Decl* decl() { return decl_; }
   void set_decl(Decl* d) { decl_ = d; }
-  std::string UnParse(void) { return decl_->UnParse(); }
-  std::string CppCode(void) { return decl_->CppCode(); }
 
  private:
   Decl* decl_;
 };
 
-
 /*!
  * Stmt ::= '{' Stmts '}'
  * This class is the representation of block statements.
  */
 class BlockStmt : public Stmt {
  public:
-  explicit BlockStmt(Stmts* s) { stmts_ = s; }
+  explicit BlockStmt(Stmts* s) : Stmt(kBlockStmt) { stmts_ = s; }
   Stmts* stmts() { return stmts_; }
   void set_stmts(Stmts* s) { stmts_ = s; }
-  std::string UnParse(void) { return " {" + stmts_->UnParse() + "} "; }
-  std::string CppCode(void) { return " {" + stmts_->CppCode() + "} "; }
 
  private:
   Stmts* stmts_;
@@ -749,16 +684,11 @@ class BlockStmt : public Stmt {
  */
 class IfStmt : public Stmt {
  public:
-  IfStmt(Expr* e, Stmt* s) { expr_ = e; stmt_ = s; }
+  IfStmt(Expr* e, Stmt* s) : Stmt(kIfStmt) { expr_ = e; stmt_ = s; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
   Stmt* stmt() { return stmt_; }
   void set_stmt(Stmt* s) { stmt_ = s; }
-  std::string UnParse(void) {
-          return "if (" + expr_->UnParse() + ") " + stmt_->UnParse(); }
-  std::string CppCode(void) {
-    return "if (" + expr_->CppCode() + ") {\n  " + stmt_->CppCode() + "}";
-  }
 
  private:
   Expr* expr_;
@@ -771,7 +701,7 @@ class IfStmt : public Stmt {
  */
 class IfElseStmt : public Stmt {
  public:
-  IfElseStmt(Expr* e, Stmt* ts, Stmt* es) {
+  IfElseStmt(Expr* e, Stmt* ts, Stmt* es) : Stmt(kIfElseStmt) {
                 expr_ = e; then_stmt_ = ts; else_stmt_ = es; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
@@ -779,13 +709,6 @@ class IfElseStmt : public Stmt {
   void set_then_stmt(Stmt* s) { then_stmt_ = s; }
   Stmt* else_stmt() { return else_stmt_; }
   void set_else_stmt(Stmt* s) { else_stmt_ = s; }
-  std::string UnParse(void) { return "if (" + expr_->UnParse() + ") " + \
-                then_stmt_->UnParse() + " else " + else_stmt_->UnParse(); }
-
-  std::string CppCode() {
-    return "if (" + expr_->CppCode() + ") {\n  " + \
-      then_stmt_->CppCode() + "} else {\n  " + else_stmt_->CppCode() + "}";
-  }
 
  private:
   Expr* expr_;
@@ -799,15 +722,13 @@ class IfElseStmt : public Stmt {
  */
 class AssignStmt : public Stmt {
  public:
-  AssignStmt(std::string s, Expr* e) { name_ = s; expr_ = e; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
+  AssignStmt(Symbol s, Expr* e) : Stmt(kAssignStmt) { name_ = s; expr_ = e; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
-  std::string UnParse(void) { return name_ + " = " + expr_->UnParse() + ";\n"; }
-  std::string CppCode(void) { return name_ + " = " + expr_->CppCode() + ";\n"; }
  private:
-  std::string name_;
+  Symbol name_;
   Expr* expr_;
 };
 
@@ -817,26 +738,20 @@ class AssignStmt : public Stmt {
  */
 class MatrixAssignStmt : public Stmt {
  public:
-  MatrixAssignStmt(std::string s, Expr* le, Expr* re, Expr* ee) {
+  MatrixAssignStmt(Symbol s, Expr* le, Expr* re, Expr* ee)
+      : Stmt(kMatrixAssignStmt) {
       name_ = s; expr_left_ = le; expr_right_ = re; expr_result_ = ee; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Expr* expr_left() { return expr_left_; }
   void set_expr_left(Expr* e) { expr_left_ = e; }
   Expr* expr_right() { return expr_right_; }
   void set_expr_right(Expr* e) { expr_right_ = e; }
   Expr* expr_result() { return expr_result_; }
   void set_expr_result(Expr* e) { expr_result_ = e; }
-  std::string UnParse(void) { return name_ + " [" + expr_left_->UnParse() + \
-  " : " + expr_right_->UnParse() + "] = " + expr_result_->UnParse()  + ";\n"; }
-  std::string CppCode(void) {
-    return "*( " + name_ + ".access(" + expr_left_->CppCode() + ", " +\
-      expr_right_->CppCode() + ")) = " + expr_result_->CppCode() + ";\n";
-  }
-
 
  private:
-  std::string name_;
+  Symbol name_;
   Expr* expr_left_;
   Expr* expr_right_;
   Expr* expr_result_;
@@ -848,11 +763,9 @@ class MatrixAssignStmt : public Stmt {
  */
 class PrintStmt : public Stmt {
  public:
-  explicit PrintStmt(Expr* e) { expr_ = e; }
+  explicit PrintStmt(Expr* e) : Stmt(kPrintStmt) { expr_ = e; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
-  std::string UnParse(void) { return "print (" + expr_->UnParse() + ");"; }
-  std::string CppCode(void) { return "cout << " + expr_->CppCode() + " ;\n"; }
 
  private:
   Expr* expr_;
@@ -864,8 +777,10 @@ class PrintStmt : public Stmt {
  */
 class RepeatStmt : public Stmt {
  public:
-  RepeatStmt(std::string name, Expr* le, Expr* ue, Stmt* s) {
+  RepeatStmt(Symbol name, Expr* le, Expr* ue, Stmt* s) : Stmt(kRepeatStmt) {
      name_ = name; expr_lower_ = le; expr_upper_ = ue; stmt_ = s; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Expr* expr_lower() { return expr_lower_; }
   void set_expr_lower(Expr* e) { expr_lower_ = e; }
   Expr* expr_upper() { return expr_upper_; }
@@ -873,19 +788,8 @@ class RepeatStmt : public Stmt {
   Stmt* stmt() { return stmt_; }
   void set_stmt(Stmt* s) { stmt_ = s; }
 
-  std::string UnParse(void) {
-     return "repeat (" + name_ + " = " + expr_lower_->UnParse() + " to " + \
-         expr_upper_->UnParse() + ")" + stmt_->UnParse();
-  }
-
-  std::string CppCode(void) {
-    return "for (" + name_ + " = " + expr_lower_->CppCode() + "; " + name_ + \
-      " <= " + expr_upper_->CppCode() + "; " + name_ + " ++ )  \n" + \
-      + "  " + stmt_->CppCode() + "\n";
-  }
-
  private:
-  std::string name_;
+  Symbol name_;
   Expr* expr_lower_;
   Expr* expr_upper_;
   Stmt* stmt_;
@@ -897,16 +801,12 @@ class RepeatStmt : public Stmt {
  */
 class WhileStmt : public Stmt {
  public:
-  explicit WhileStmt(Expr* e, Stmt* s) { expr_ = e; stmt_ = s; }
+  explicit WhileStmt(Expr* e, Stmt* s)
+      : Stmt(kWhileStmt) { expr_ = e; stmt_ = s; }
   Expr* expr() { return expr_; }
   void set_expr(Expr* e) { expr_ = e; }
   Stmt* stmt() { return stmt_; }
   void set_stmt(Stmt* e) { stmt_ = e; }
-  std::string UnParse(void) {
-           return "while (" + expr_->UnParse() + ") " + stmt_->UnParse(); }
-  std::string CppCode() {
-    return "while (" + expr_->CppCode() + ") {\n" + stmt_->CppCode() + "}\n";
-  }
 
  private:
   Expr* expr_;
@@ -919,9 +819,7 @@ class WhileStmt : public Stmt {
  */
 class EmptyStmt : public Stmt {
  public:
-  EmptyStmt(void) {}
-  std::string UnParse(void) { return ";\n"; }
-  std::string CppCode(void) { return ";\n"; }
+  EmptyStmt(void) : Stmt(kEmptyStmt) {}
 };
 
 /*!
@@ -930,23 +828,17 @@ class EmptyStmt : public Stmt {
  */
 class LetExpr : public Expr {
  public:
-    LetExpr(Stmts* s, Expr* e) { stmts_ = s; expr_ = e; }
+    LetExpr(Stmts* s, Expr* e) : Expr(kLetExpr) { stmts_ = s; expr_ = e; }
     Stmts* stmts() { return stmts_; }
     void set_stmts(Stmts* s) { stmts_ = s; }
     Expr* expr() { return expr_; }
     void set_expr(Expr* e) { expr_ = e; }
-    std::string UnParse() { return "let " + stmts_->UnParse() \
-        + "in " + expr_->UnParse() + " end"; }
-    std::string CppCode() {
-      return "({ " + stmts_->CppCode() + "\n  " + expr_->CppCode() + "; })";
-    }
 
  private:
     Stmts* stmts_;
     Expr* expr_;
 };
 
-
 /*!
  * Program ::= varName '(' ')' '{' Stmts '}'
  * This class is the representation of Program which inherits directly
@@ -954,22 +846,15 @@ class LetExpr : public Expr {
  */
 class Program : public Node {
  public:
-  Program(std::string s, Stmts* stmts) { name_ = s; stmts_ = stmts; }
-  std::string name() { return name_; }
-  void set_name(std::string s) { name_ = s; }
+  Program(Symbol s, Stmts* stmts)
+      : Node(kProgram) { name_ = s; stmts_ = stmts; }
+  Symbol name() { return name_; }
+  void set_name(Symbol s) { name_ = s; }
   Stmts* stmts() { return stmts_; }
   void set_stmts(Stmts* ss) { stmts_ = ss; }
-  std::string UnParse() {return name_ + "() {\n" + stmts_->UnParse() + "}";}
-  std::string CppCode() {
-    std::string headers;
-    // headers.append("#include <iostream>\n");
-    headers += "#include <iostream>\n#include \"../include/Matrix.h\"\n";
-    headers += "#include <math.h>\nusing namespace std;\nint ";
-    return headers + name_ + "() {\n" + stmts_->CppCode() + "}";
-  }
 
  private:
-  std::string name_;
+  Symbol name_;
   Stmts* stmts_;
 };
 
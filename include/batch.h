@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Name            : batch.h
+ * Project         : fcal
+ * Module          : parser
+ * Description     : Header file for parsing and translating many programs
+ *                   at once on a thread pool.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_BATCH_H_
+#define PROJECT_INCLUDE_BATCH_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <vector>
+#include "./parse_result.h"
+#include "./thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace parser {
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/* The C++ translation of one program, or why there is none. */
+struct Translation {
+  bool ok;
+  std::string cpp;
+  std::string errors;
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * Parses each of [texts] on [pool], with one Parser per worker; the DFA
+ * tables and the token rules the Parsers use are shared and read-only.
+ * The results are in the order of [texts] and are exactly those that
+ * Parser::Parse() would give one after another, however the work was
+ * shared out. The texts must stay valid until the call returns.
+ *
+ * Must not be called from one of the pool's own workers.
+ */
+std::vector<ParseResult> ParseMany(const std::vector<const char *> &texts,
+                                   ThreadPool *pool);
+
+/*
+ * The same, translating each program to C++ as soon as it is parsed and
+ * keeping only the code, so that each worker's Parser recycles its arena
+ * from one program to the next. Each tree is type-checked once, by an
+ * ast::TypeChecker, then simplified and pruned by ast::Simplifier and
+ * ast::DeadCodeEliminator. A program that does not type-check has no
+ * translation; its errors are the checker's, one per line.
+ */
+std::vector<Translation> TranslateMany(const std::vector<const char *> &texts,
+                                       ThreadPool *pool);
+
+} /* namespace parser */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_BATCH_H_ */
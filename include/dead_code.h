@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Name            : dead_code.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the pass that removes the statements of
+ *                   an AST that cannot run or whose work is never used.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_DEAD_CODE_H_
+#define PROJECT_INCLUDE_DEAD_CODE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <unordered_set>
+#include "./arena.h"
+#include "./ast.h"
+#include "./visitor.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * DeadCodeEliminator
+ * Removes the statements of a tree that cannot run or whose work is never
+ * used:
+ *  - the branch an if statement with a constant condition does not take,
+ *    and while loops whose condition is False;
+ *  - empty blocks, and if statements with nothing left to run whose
+ *    condition has no let expression;
+ *  - the declaration of a variable that is never read, with every
+ *    statement that sets it, such as a dead matrix_read(). Reads made only
+ *    by the statements that go with it are not counted, so that chains of
+ *    variables that only feed one another go together.
+ *
+ * A statement other than a declaration inside a let expression is kept,
+ * with whatever it is part of, as it may print, loop or set a variable.
+ * Constant conditions are only seen as such when they are True or False,
+ * as Simplifier leaves them. Like it, the pass allocates what it makes in
+ * the arena of the tree, which must not be given to Parser::Reparse()
+ * afterwards.
+ */
+class DeadCodeEliminator : public Walker<DeadCodeEliminator> {
+ public:
+  /* Prunes trees that live in [arena] */
+  explicit DeadCodeEliminator(Arena *arena)
+      : arena_(arena), dead_(), dropped_(false) {}
+
+  /* Prunes the tree under [root] and returns what replaced it */
+  Node *Eliminate(Node *root);
+
+  // The pass itself, run by Walk():
+  Node *VisitStmts(Stmts *node);
+  Node *VisitDeclStmt(DeclStmt *node) { return Kept(node); }
+  Node *VisitIfStmt(IfStmt *node);
+  Node *VisitIfElseStmt(IfElseStmt *node);
+  Node *VisitAssignStmt(AssignStmt *node) { return Kept(node); }
+  Node *VisitMatrixAssignStmt(MatrixAssignStmt *node) { return Kept(node); }
+  Node *VisitWhileStmt(WhileStmt *node);
+
+ private:
+  /* [node], or an empty block if it was found dead */
+  Stmt *Kept(Stmt *node) {
+    return (dead_.count(node) != 0) ? Empty() : node;
+  }
+  /* [node] in place of a statement it was the body of */
+  Stmt *Body(Stmt *node);
+  /* A block of [node] alone */
+  Stmt *Block(Stmt *node);
+  Stmt *Empty(void);
+  /* An empty block for a statement whose condition is dropped */
+  Stmt *Dropped(void) {
+    dropped_ = true;
+    return Empty();
+  }
+
+  Arena *arena_;
+  /* The statements that only set variables nothing reads */
+  std::unordered_set<Stmt *> dead_;
+  /* Whether the last walk dropped a condition that was not constant */
+  bool dropped_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_DEAD_CODE_H_ */
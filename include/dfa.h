@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Name            : dfa.h
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : Header file for the table-driven DFA used by the scanner
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_DFA_H_
+#define PROJECT_INCLUDE_DFA_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "./nfa.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+const int kDfaDeadState = 0;
+const int kDfaStartState = 1;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * DfaTables
+ * A read-only view of a DFA's transition tables. The scanner's tables are
+ * generated at build time as constexpr data of this shape (see lexgen.cc).
+ */
+struct DfaTables {
+  int num_classes;
+  const uint8_t *classes;
+  const int16_t *next;
+  const int16_t *accept;
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * dfa_match() - Run the DFA over the bytes in [text, end) and report the
+ * longest prefix that it accepts. The text need not be NUL-terminated, and
+ * no pattern matches a NUL byte.
+ *
+ * RETURN:
+ *     size_t - The length of the match, or 0 if there is none. [tag] is set
+ *              to the tag of the match, or kNfaNoTag. If [stop] is given it
+ *              is set to the last byte the DFA read, the one it died on, or
+ *              to [end] if it ran out of text first.
+ */
+inline size_t dfa_match(const DfaTables &dfa, const char *text,
+                        const char *end, int *tag,
+                        const char **stop = NULL) {
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(text);
+  const unsigned char *limit = reinterpret_cast<const unsigned char *>(end);
+  const unsigned char *accepted = s;
+  const unsigned char *p = s;
+  int state = kDfaStartState;
+  *tag = kNfaNoTag;
+
+  for (; p < limit; p++) {
+    state = dfa.next[state * dfa.num_classes + dfa.classes[*p]];
+    if (state == kDfaDeadState) {
+      break;
+    }
+    if (dfa.accept[state] != kNfaNoTag) {
+      accepted = p + 1;
+      *tag = dfa.accept[state];
+    }
+  }
+  if (stop != NULL) {
+    *stop = reinterpret_cast<const char *>(p);
+  }
+  return accepted - s;
+}
+
+/*!
+ * Dfa
+ * A minimized DFA built from an Nfa by subset construction. Bytes are
+ * grouped into equivalence classes so that the transition table has one
+ * column per class instead of one per byte.
+ *
+ * Each accepting state carries the smallest tag among the NFA match states
+ * it contains, so when two patterns match the same text the one with the
+ * smaller tag wins.
+ */
+class Dfa {
+ public:
+  Dfa(void) : num_classes_(0), next_(), accept_() {}
+
+  /* Returns false if the NFA has more states than the table can address. */
+  bool Build(const Nfa &nfa);
+
+  /* Returns the longest prefix of [text, end) that the DFA accepts. */
+  size_t Match(const char *text, const char *end, int *tag) const {
+    return dfa_match(tables(), text, end, tag);
+  }
+
+  DfaTables tables(void) const {
+    DfaTables t = { num_classes_, classes_, &next_[0], &accept_[0] };
+    return t;
+  }
+
+  int num_states(void) const {
+    return static_cast<int>(accept_.size());
+  }
+  int num_classes(void) const { return num_classes_; }
+
+ private:
+  void Minimize(void);
+
+  uint8_t classes_[256];
+  int num_classes_;
+  std::vector<int16_t> next_;
+  std::vector<int16_t> accept_;
+};
+
+} /* namespace scanner */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_DFA_H_ */
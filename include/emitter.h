@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Name            : emitter.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the emitter that writes an AST out as
+ *                   text, into one growing string or straight to a file.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_EMITTER_H_
+#define PROJECT_INCLUDE_EMITTER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "./symbol_table.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+class Node;
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* What a tree is written out as. */
+enum Language {
+  kFcal,  /* the source it was parsed from, as Node::UnParse() gives */
+  kCpp    /* its translation, as Node::CppCode() gives */
+};
+
+/* Bytes an Emitter collects at most before writing them to a file. */
+const size_t kEmitBufferSize = 64 * 1024;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Emitter
+ * Writes the text of a tree in a single pass. Each node only lists the
+ * pieces of its text in order, with its children in between, through the
+ * << operators; the emitter writes the text and expands the children in
+ * their place from a stack of its own. Nothing is copied more than once
+ * and no C++ stack is used per level of the tree, however deep it is.
+ * The text of a node up to its first child is written straight away, so
+ * leaves never touch the stack.
+ *
+ * The text handed to << is not copied until it is written, so it must last
+ * until Emit() returns: string literals, symbols and the strings that the
+ * nodes hold all do.
+ */
+class Emitter {
+ public:
+  /* Appends to [out] directly; it must outlive the emitter. */
+  explicit Emitter(std::string *out)
+      : out_(out), fd_(-1), buffer_(), capacity_(0), used_(0), parts_(),
+        first_(0), language_(kFcal), ok_(true) {}
+  /*
+   * Writes to the file descriptor [fd], which the emitter does not close,
+   * through a buffer that grows with the output up to kEmitBufferSize.
+   */
+  explicit Emitter(int fd)
+      : out_(NULL), fd_(fd), buffer_(), capacity_(0), used_(0), parts_(),
+        first_(0), language_(kFcal), ok_(true) {}
+  ~Emitter(void) { Flush(); }
+
+  /*
+   * Writes out the tree under [root] as [language]. Translating to C++
+   * only reads the types a TypeChecker set on the whole program: an
+   * expression it has not typed is translated as if its type were unknown.
+   */
+  void Emit(Node *root, Language language);
+
+  /*
+   * Writes what is buffered out to the file. Returns false if that or any
+   * earlier write to it failed.
+   */
+  bool Flush(void);
+  bool ok(void) const { return ok_; }
+
+  /* The language of the tree being emitted */
+  Language language(void) const { return language_; }
+
+  /* For the nodes: the next piece of text, or the child to write next */
+  Emitter &operator<<(const char *text) { return Add(text, strlen(text)); }
+  Emitter &operator<<(const std::string &text) {
+    return Add(text.data(), text.size());
+  }
+  Emitter &operator<<(const Symbol &name) { return *this << name.str(); }
+  Emitter &operator<<(Node *child) {
+    Part part = { NULL, 0, child };
+    parts_.push_back(part);
+    return *this;
+  }
+
+ private:
+  Emitter(const Emitter &) = delete;
+  Emitter &operator=(const Emitter &) = delete;
+
+  /* A piece of text, or a node still to be expanded if [node] is set. */
+  struct Part {
+    const char *text;
+    size_t length;
+    Node *node;
+  };
+
+  /* Text before a node's first child is written at once. */
+  Emitter &Add(const char *text, size_t length) {
+    if (parts_.size() == first_) {
+      Write(text, length);
+    } else {
+      Part part = { text, length, NULL };
+      parts_.push_back(part);
+    }
+    return *this;
+  }
+
+  void Write(const char *text, size_t length) {
+    if (out_ != NULL) {
+      out_->append(text, length);
+    } else if (length <= capacity_ - used_) {
+      memcpy(buffer_.get() + used_, text, length);
+      used_ += length;
+    } else {
+      WriteSlow(text, length);
+    }
+  }
+  void WriteSlow(const char *text, size_t length);
+  void WriteOut(const char *text, size_t length);
+
+  std::string *out_;
+  int fd_;
+  std::unique_ptr<char[]> buffer_;
+  size_t capacity_;
+  size_t used_;
+  /* What is left to write, the next part last */
+  std::vector<Part> parts_;
+  /* Where the parts of the node being expanded start */
+  size_t first_;
+  Language language_;
+  bool ok_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_EMITTER_H_ */
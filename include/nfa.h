@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Name            : nfa.h
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : Header file for the Thompson NFA built from the POSIX
+ *                   extended regular expressions used by the scanner.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_NFA_H_
+#define PROJECT_INCLUDE_NFA_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <bitset>
+#include <vector>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+const int kNfaNoState = -1;
+const int kNfaNoTag = -1;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * CharSet
+ * The set of bytes a single NFA transition accepts.
+ */
+typedef std::bitset<256> CharSet;
+
+/*!
+ * NfaState
+ * A Thompson NFA state. A state either consumes one byte from [chars] and
+ * moves to [out], has up to two epsilon edges [out] and [out1], or accepts
+ * with [tag].
+ */
+struct NfaState {
+  enum Kind { kCharState, kSplitState, kMatchState };
+
+  Kind kind;
+  CharSet chars;
+  int out;
+  int out1;
+  int tag;
+};
+
+/*!
+ * Nfa
+ * A Thompson NFA for one or more anchored patterns. Patterns use the subset
+ * of POSIX extended syntax that the scanner needs: literals, escapes,
+ * bracket expressions, '.', grouping, '|', '*', '+' and '?'. Inside brackets
+ * a backslash is an ordinary character, as POSIX requires. No pattern ever
+ * matches a NUL byte, so NUL-terminated text stops every match.
+ *
+ * Every pattern added with AddPattern() is reachable from start(), and its
+ * match state carries the tag it was added with.
+ */
+class Nfa {
+ public:
+  Nfa(void) : states_(), start_(kNfaNoState) {}
+
+  /* Returns false if the pattern is malformed or uses unsupported syntax. */
+  bool AddPattern(const char *pattern, int tag);
+
+  int start(void) const { return start_; }
+  int num_states(void) const { return static_cast<int>(states_.size()); }
+  const NfaState &state(int i) const { return states_[i]; }
+
+  /* Adds the epsilon closure of the states in [set] to [set]. */
+  void Closure(std::vector<int> *set) const;
+
+  /*
+   * Groups the 256 byte values into classes: two bytes share a class when
+   * every transition accepts both or neither. Fills in the class of each
+   * byte and one byte of each class, and returns the number of classes.
+   */
+  int ByteClasses(uint8_t classes[256], std::vector<int> *representative)
+      const;
+
+ private:
+  /* A partially built automaton; each dangling edge is state * 2 + edge. */
+  struct Fragment {
+    int start;
+    std::vector<int> dangling;
+  };
+
+  int AddState(NfaState::Kind kind);
+  void Patch(const Fragment &f, int target);
+
+  bool ParseAlternation(const char **p, Fragment *f);
+  bool ParseConcatenation(const char **p, Fragment *f);
+  bool ParseRepetition(const char **p, Fragment *f);
+  bool ParseAtom(const char **p, Fragment *f);
+  bool ParseBracket(const char **p, CharSet *set);
+  Fragment CharFragment(const CharSet &set);
+
+  std::vector<NfaState> states_;
+  int start_;
+};
+
+} /* namespace scanner */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_NFA_H_ */
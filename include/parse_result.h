@@ -5,7 +5,7 @@
  * Description     : a simple object for holding the result of a parse.
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Erik Van Wyk
- * Modifications by: Dan Challou, John Harwell
+ * Modifications by: Dan Challou, John Harwell, Son Nguyen, Yu Fang
  *
  ******************************************************************************/
 
@@ -15,8 +15,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <stddef.h>
+#include <memory>
 #include <string>
+#include <vector>
+#include "./arena.h"
 #include "./ast.h"
+#include "./symbol_table.h"
 
 /*******************************************************************************
  * Namespaces
@@ -24,23 +29,92 @@
 namespace fcal {
 namespace parser {
 
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/* One syntax error, found at the token starting [offset] bytes into the text */
+struct ParseError {
+  size_t offset;
+  std::string message;
+};
+
+/*
+ * Where one statement of a program's body lies in the text it was parsed
+ * from. Only statements that parsed without error are recorded.
+ */
+struct StmtSpan {
+  size_t begin;  /* the statement's first token */
+  size_t end;    /* one past its last token */
+  size_t next;   /* the token after it */
+  size_t reach;  /* one past the furthest byte its parse depended on */
+  size_t index;  /* its place in the body's array of statements */
+};
+
+/*
+ * What Parser::Reparse() needs to know about a parse: the program node,
+ * which it keeps even if the parse failed, and the spans of its body's
+ * statements, in order. Lives in the arena of the parse; Reparse() refills
+ * the body's array in place while it has room.
+ */
+struct ParseOutline {
+  ast::Program *program;
+  size_t text_length;
+  size_t body_begin;    /* one past the program's '{' */
+  size_t header_reach;  /* reach of the part up to there */
+  StmtSpan *spans;
+  size_t num_spans;
+  size_t capacity;
+  size_t body_capacity;
+  size_t parsed_bytes;  /* arena bytes in use after the full parse */
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
+/*!
+ * ParseResult
+ * The AST of a successful parse lives in an arena that the result shares
+ * with its copies; the whole tree is freed when the last of them goes away.
+ * The symbol table of the names in the tree lives in the same arena.
+ *
+ * A failed parse has no tree; errors() holds its error messages, one per
+ * line, in the order they were found. It still keeps its arena if the
+ * program's header parsed, so that the statements which did parse can be
+ * reused by Parser::Reparse(); outline() is NULL when there is nothing to
+ * reuse.
+ */
 class ParseResult {
  public:
-  ParseResult(void) : errors_(), ast_(NULL), ok_(true) {}
+  ParseResult(void)
+      : errors_(), error_list_(), ast_(NULL), arena_(), symbols_(NULL),
+        outline_(NULL), ok_(true) {}
 
   bool ok(void) const { return ok_; }
   void ok(bool result_in) { ok_ = result_in; }
   std::string errors(void) const { return errors_; }
   void errors(const std::string str_in) { errors_ = str_in;}
+  const std::vector<ParseError> &error_list(void) const {
+    return error_list_;
+  }
+  void error_list(const std::vector<ParseError> &list_in) {
+    error_list_ = list_in;
+  }
   ast::Node *ast(void) { return ast_; }
   void ast(ast::Node * Node_ptr) { ast_ = Node_ptr; }
+  std::shared_ptr<Arena> arena(void) const { return arena_; }
+  void arena(std::shared_ptr<Arena> arena_in) { arena_ = arena_in; }
+  ast::SymbolTable *symbols(void) const { return symbols_; }
+  void symbols(ast::SymbolTable *symbols_in) { symbols_ = symbols_in; }
+  ParseOutline *outline(void) const { return outline_; }
+  void outline(ParseOutline *outline_in) { outline_ = outline_in; }
 
  private:
   std::string errors_;
+  std::vector<ParseError> error_list_;
   ast::Node *ast_;
+  std::shared_ptr<Arena> arena_;
+  ast::SymbolTable *symbols_;
+  ParseOutline *outline_;
   bool ok_;
 };
 
@@ -6,7 +6,7 @@
  *
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Erik Van Wyk
- * Modifications by: Dan Challou, John Harwell
+ * Modifications by: Dan Challou, John Harwell, Son Nguyen, Yu Fang
  *
  ******************************************************************************/
 
@@ -16,7 +16,11 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
+#include "./arena.h"
 #include "./parse_result.h"
 #include "./scanner.h"
 
@@ -24,11 +28,32 @@
  * Namespaces
  ******************************************************************************/
 namespace fcal {
-namespace scanner {
-class ExtToken;
-} /* namespace scanner */
 namespace parser {
 
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/*
+ * Reparse() adds to the arena of the parse it starts from, and starts over
+ * with a full parse once that arena holds this many times what the last
+ * full parse put there.
+ */
+const size_t kReparseGrowth = 2;
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/*
+ * One change to a text: the [removed] bytes at [offset] were replaced by
+ * [inserted] new ones. The offset is into the text as the edits before it
+ * in the same list left it.
+ */
+struct TextEdit {
+  size_t offset;
+  size_t removed;
+  size_t inserted;
+};
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -47,14 +72,55 @@ namespace parser {
  *
  * These are both quite interesting works and worth reading if you
  * find the problem of parsing to be an interesting one.
+ *
+ * Unlike those, parse_expr() keeps the expressions it has begun on a stack
+ * of its own instead of recursing, and sequences of statements are parsed
+ * by a loop, so however long a program or deep its parentheses, parsing
+ * takes the same C++ stack; only statements nested inside statements
+ * recurse.
+ *
+ * A Parser is not thread-safe, but Parsers share nothing that changes: the
+ * token rules and the scanner's DFA tables are constant, and each Parser
+ * has its own scanner and arena. Give each thread a Parser of its own, as
+ * ParseMany() (batch.h) does.
  */
 class Parser {
  public:
   Parser(void)
-      : curr_token_(NULL), prev_token_(NULL), stokens_(NULL), scanner_(NULL) {}
+      : curr_token_(), prev_token_(), scanner_(NULL), arena_(),
+        symbols_(NULL), outline_(NULL), spans_(), stmt_stack_(),
+        expr_stack_(), errors_(), panicking_(false) {}
   ~Parser(void);
 
+  /*
+   * Parses the whole of [text]. No exceptions are thrown: every syntax
+   * error is recorded and the parser recovers at the next ';' or '}', so
+   * the result reports all the errors that one pass can find.
+   */
   ParseResult Parse(const char *text);
+
+  /*
+   * Parses [text], which is the text [previous] was parsed from after
+   * [edits]. Only the statements of the program's body that the edits
+   * could have changed are scanned and parsed again; the others, and their
+   * subtrees, are reused as they are, so the work done depends on the size
+   * of the edits rather than that of the text. The result is the same as
+   * Parse(text) would give.
+   *
+   * The tree of [previous] is relinked in place to build the new one, so
+   * neither [previous] nor any copy of it may be used afterwards. Falls
+   * back on a full parse when [previous] has nothing to reuse.
+   */
+  ParseResult Reparse(const ParseResult &previous, const char *text,
+                      const std::vector<TextEdit> &edits);
+
+  /*
+   * Forgets the last parse but keeps its buffers (the scanner, the arena,
+   * the error list) for the next one. The arena is only recycled if no
+   * ParseResult still holds it; otherwise the next parse gets a new one.
+   * Parse() calls this itself, so a Parser can be reused indefinitely.
+   */
+  void Reset(void);
   // Parser methods for the nonterminals:
 
   ParseResult ParseProgram();
@@ -63,44 +129,136 @@ class Parser {
   ParseResult parse_matrix_decl();
   ParseResult parse_stmts();
   ParseResult parse_stmt();
-  ParseResult parse_expr(int rbp);
-  // methods for parsing productions for Expr
-  ParseResult parse_true_kwd();
-  ParseResult parse_false_kwd();
-  ParseResult parse_int_const();
-  ParseResult parse_float_const();
-  ParseResult parse_string_const();
-  ParseResult parse_char_const();
-  ParseResult parse_variable_name();
-  ParseResult parse_nested_expr();
-  ParseResult parse_not_expr();
-  ParseResult parse_let_expr();
-  ParseResult parse_if_expr();
-  ParseResult parse_addition(ParseResult left);
-  ParseResult parse_multiplication(ParseResult left);
-  ParseResult parse_subtraction(ParseResult left);
-  ParseResult parse_division(ParseResult left);
-
-  ParseResult parse_relational_expr(ParseResult left);
+  void parse_body(ast::Program *program, const ParseOutline *old,
+                  size_t first, size_t reuse_from, size_t new_length,
+                  size_t reach);
+  ast::Expr *parse_expr(int rbp);
+  /*
+   * methods for parsing productions for Expr. Each one that needs an Expr
+   * inside it parses up to there, asks for that operand with
+   * expect_operand() and returns NULL; parse_expr() parses the operand and
+   * passes it to the matching finish_ method, which completes the node or
+   * asks for the next operand.
+   */
+  ast::Expr *parse_true_kwd();
+  ast::Expr *parse_false_kwd();
+  ast::Expr *parse_int_const();
+  ast::Expr *parse_float_const();
+  ast::Expr *parse_string_const();
+  ast::Expr *parse_char_const();
+  ast::Expr *parse_variable_name();
+  ast::Expr *parse_nested_expr();
+  ast::Expr *parse_not_expr();
+  ast::Expr *parse_let_expr();
+  ast::Expr *parse_if_expr();
+  void parse_binary_expr(ast::Expr *left);
 
   // Helper function used by the parser.
-  void match(const scanner::TokenType &tt);
+  /* Consumes a [tt] token, or records an error and returns false */
+  bool match(const scanner::TokenType &tt);
   bool attempt_match(const scanner::TokenType &tt);
   bool next_is(const scanner::TokenType &tt);
   void next_token(void);
 
  private:
-  std::string terminal_description(const scanner::TokenType &terminal);
   std::string make_error_msg(const scanner::TokenType &terminal);
   std::string make_error_msg_expected(const scanner::TokenType &terminal);
   std::string make_error_msg(const char *msg);
+  void error(const std::string &msg);
+  void synchronize(void);
+  ParseResult finish(ParseResult pr, size_t length);
+
+  /*
+   * An Expr that parse_expr() has begun but that is waiting for an operand,
+   * which binds to it only if the operator after the operand has a left
+   * binding power above [rbp]. [finish] is called with the operand; the
+   * other fields hold what the node has been given so far.
+   */
+  struct ExprFrame;
+  typedef ast::Expr *(Parser::*ExprFinisher)(const ExprFrame &frame,
+                                              ast::Expr *operand);
+  struct ExprFrame {
+    int rbp;
+    ExprFinisher finish;
+    scanner::TokenType op;
+    ast::Symbol name;
+    ast::Expr *first;
+    ast::Expr *second;
+    ast::Stmts *stmts;
+  };
+
+  ExprFrame &expect_operand(int rbp, ExprFinisher finish) {
+    expr_stack_.push_back(ExprFrame());
+    expr_stack_.back().rbp = rbp;
+    expr_stack_.back().finish = finish;
+    return expr_stack_.back();
+  }
+
+  ast::Expr *finish_matrix_row(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_matrix_ref(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_call(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_nested_expr(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_not_expr(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_let_expr(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_if_cond(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_if_then(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_if_expr(const ExprFrame &frame, ast::Expr *operand);
+  ast::Expr *finish_binary_expr(const ExprFrame &frame, ast::Expr *operand);
+
+  ast::Stmts *pop_stmts(size_t base);
 
-  scanner::ExtToken *tokens_;
-  scanner::ExtToken *curr_token_;
-  scanner::ExtToken *prev_token_;
+  std::string lexeme(const scanner::CompactToken &t) const {
+    return scanner_->lexeme(t);
+  }
 
-  scanner::Token *stokens_;
+  /* The symbol for the name [t] spans; no lexeme is copied. */
+  ast::Symbol intern(const scanner::CompactToken &t) {
+    return symbols_->Intern(scanner_->text() + t.offset, t.length);
+  }
+
+  /* Allocates an AST node in the arena of the parse in progress. */
+  template <typename T, typename... Args>
+  T *make_node(Args&&... args) {
+    return arena_->New<T>(std::forward<Args>(args)...);
+  }
+
+  /*
+   * Tokens are pulled from the scanner one at a time as the parser advances,
+   * and are plain values; how each kind of token parses is looked up in
+   * kTokenRules (ext_token.h).
+   */
+  scanner::CompactToken curr_token_;
+  scanner::CompactToken prev_token_;
   scanner::Scanner *scanner_;
+
+  /*
+   * Every node of the tree being built; handed over to the ParseResult that
+   * Parse() returns.
+   */
+  std::shared_ptr<Arena> arena_;
+  /* The names in that tree; lives in arena_ */
+  ast::SymbolTable *symbols_;
+  /*
+   * The outline of that tree, also in arena_, or NULL if the program's
+   * header did not parse. spans_ collects its spans as the body is parsed.
+   */
+  ParseOutline *outline_;
+  std::vector<StmtSpan> spans_;
+
+  /*
+   * The statements of the sequences being parsed, innermost last, and the
+   * expressions waiting for operands; kept from one parse to the next so
+   * that neither grows the C++ stack nor allocates once warmed up.
+   */
+  std::vector<ast::Stmt *> stmt_stack_;
+  std::vector<ExprFrame> expr_stack_;
+
+  /*
+   * The errors found so far. While panicking_ is set the parser is skipping
+   * the rest of a broken statement and reports nothing new.
+   */
+  std::vector<ParseError> errors_;
+  bool panicking_;
 };
 
 } /* namespace parser */
@@ -6,23 +6,78 @@
  *                   character buffer
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Eric Van Wyk
- * Modifications by: John Harwell
+ * Modifications by: John Harwell, Son Nguyen, Yu Fang
  ******************************************************************************/
 
 #ifndef PROJECT_INCLUDE_READ_INPUT_H_
 #define PROJECT_INCLUDE_READ_INPUT_H_
 
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <vector>
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 namespace fcal {
 namespace scanner {
 
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * InputBuffer
+ * Owns the contents of an input file, or of anything readable through a
+ * file descriptor, and hands out a read-only view of them. A regular file
+ * is memory-mapped, so nothing is copied; anything that cannot be mapped,
+ * such as a pipe, is read into memory instead. Either way the view stays
+ * valid until the InputBuffer is reset or destroyed.
+ *
+ * A mapped view is not NUL-terminated, so pass it to the scanner's
+ * bounded entry points (Tokenize(begin, length, ...), Start()).
+ */
+class InputBuffer {
+ public:
+  InputBuffer(void) : data_(""), size_(0), mapped_(false), buffer_() {}
+  ~InputBuffer(void) { Reset(); }
+
+  /* Returns false if [filename] cannot be opened or read. */
+  bool Open(const char *filename);
+
+  /*
+   * Takes in everything left on [fd], such as STDIN_FILENO or one end of a
+   * pipe, and leaves [fd] open. Returns false on a read error.
+   */
+  bool ReadFrom(int fd);
+
+  /* Releases the view; data() is empty afterwards. */
+  void Reset(void);
+
+  const char *data(void) const { return data_; }
+  size_t size(void) const { return size_; }
+  bool mapped(void) const { return mapped_; }
+
+ private:
+  InputBuffer(const InputBuffer &) = delete;
+  InputBuffer &operator=(const InputBuffer &) = delete;
+
+  bool ReadAll(int fd, size_t size_hint);
+
+  const char *data_;
+  size_t size_;
+  bool mapped_;
+  std::vector<char> buffer_;
+};
+
 /*******************************************************************************
  * Functions
  ******************************************************************************/
+/* Reads argv[1], or standard input when it is missing or "-". */
 char *ReadInput(int argc, char **argv);
 char *ReadInputFromFile(const char *filename);
+char *ReadInputFromFd(int fd);
 
 } /* namespace scanner */
 } /* namespace fcal */
@@ -5,7 +5,7 @@
  * Description     : Header file for regex module
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Eric Van Wyk
- * Modifications by: John Harwell
+ * Modifications by: John Harwell, Son Nguyen, Yu Fang
  ******************************************************************************/
 
 #ifndef PROJECT_INCLUDE_REGEX_H_
@@ -14,7 +14,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <regex.h>
+#include <stdint.h>
+#include <vector>
+#include "./nfa.h"
 
 /*******************************************************************************
  * Namespaces
@@ -25,13 +27,86 @@ namespace scanner {
 /*******************************************************************************
  * Constant Definitions
  ******************************************************************************/
-const int kRegexNSub = 1;
+/* The most DFA states a Regex keeps before it flushes its cache. */
+const int kRegexMaxCachedStates = 128;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Regex
+ * A compiled pattern. The pattern becomes a Thompson NFA once, and the NFA is
+ * turned into a DFA lazily: a DFA state and its transitions are only worked
+ * out the first time a match reaches them, and are cached for later matches.
+ *
+ * Every table the cache uses is allocated when the pattern is compiled, so
+ * Match() never allocates. When the cache is full it is flushed and refilled
+ * as matching continues.
+ *
+ * Matching is always anchored at the start of the text, whether or not the
+ * pattern begins with '^', and the pattern syntax is that of Nfa. Because
+ * Match() fills in the cache, one Regex must not be matched from two threads
+ * at once.
+ */
+class Regex {
+ public:
+  Regex(void);
+
+  /* Returns false if the pattern is malformed or uses unsupported syntax. */
+  bool Compile(const char *pattern);
+
+  /* Returns the length of the longest match at the start of [text]. */
+  int Match(const char *text);
+
+ private:
+  Regex(const Regex &) = delete;
+  Regex &operator=(const Regex &) = delete;
+
+  void AddToClosure(int s);
+  int Step(int state, int cls);
+  int FindState(void) const;
+  int AddState(void);
+  void Flush(void);
+
+  Nfa nfa_;
+  uint8_t classes_[256];
+  std::vector<uint8_t> representative_;
+  int num_classes_;
+
+  /* The cached DFA. State 0 is the dead state; state 1 is the start. */
+  std::vector<int> next_;
+  std::vector<bool> accept_;
+  std::vector<int> set_begin_;
+  std::vector<int> sets_;
+  std::vector<int> table_;
+  int num_states_;
+  std::vector<int> start_set_;
+
+  /* Scratch space for computing one transition. */
+  std::vector<int> closure_;
+  std::vector<int> stack_;
+  std::vector<unsigned> mark_;
+  unsigned generation_;
+};
 
 /*******************************************************************************
  * Forward Declarations
  ******************************************************************************/
+} /* namespace scanner */
+} /* namespace fcal */
+
+typedef fcal::scanner::Regex regex_t;
+
+namespace fcal {
+namespace scanner {
+
+/*
+ * make_regex() returns NULL if the pattern cannot be compiled. match_regex()
+ * returns the length of the longest match at the start of [text], or 0.
+ */
 regex_t *make_regex(const char* pattern);
 int match_regex(regex_t *, const char *);
+void free_regex(regex_t *);
 
 } /* namespace scanner */
 } /* namespace fcal */
@@ -14,8 +14,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <regex.h>
+#include <stdint.h>
 #include <string>
+#include <vector>
 #include "./regex.h"
 // #include "token.h"
 
@@ -25,6 +26,7 @@
  * Namespaces
  ******************************************************************************/
 namespace fcal {
+class ThreadPool;
 namespace scanner {
 
 class Scanner;
@@ -97,6 +99,37 @@ enum kTokenEnumType {
       TokenType type;
   } Result;
 
+  /* A terminal and the anchored regular expression that recognizes it */
+  typedef struct TokenSpec {
+      TokenType terminal;
+      const char *pattern;
+  } TokenSpec;
+
+  /* One spec per terminal, from kIntKwd through kNotOp */
+  extern const TokenSpec kTokenSpecs[];
+  extern const int kNumTokenSpecs;
+
+  /* Whitespace and comment patterns, skipped between tokens. The scanner
+     skips them with the hand-written skip_whitespace_and_comments() (see
+     skip.h); kSkipDfa, generated from them, is its reference */
+  extern const char *const kSkipPatterns[];
+  extern const int kNumSkipPatterns;
+
+  /* Offsets in the [length] bytes at [begin] where a scan may be split:
+     each is a whitespace byte outside every string constant and comment,
+     so the single-threaded scan has a token boundary there. Successive
+     offsets are at least [chunk] bytes apart */
+  std::vector<size_t> find_split_points(const char *begin, size_t length,
+                                        size_t chunk);
+
+  inline bool is_keyword(TokenType terminal) {
+      return terminal >= kIntKwd && terminal <= kToKwd;
+  }
+
+  /* The keyword spelled by the variable name text[0..length), if any,
+     otherwise kVariableName */
+  TokenType lookup_keyword(const char *text, int length);
+
 /*******************************************************************************
  * Class Definitions
  *
@@ -155,16 +188,143 @@ class Token {
     Token *next_;
 };
 
+/*
+ * CompactToken
+ * A token as a span of the scanned text: no lexeme is copied.
+ */
+typedef struct CompactToken {
+    size_t offset;
+    uint32_t length;
+    TokenType terminal;
+} CompactToken;
+
+/*
+ * TokenStream
+ * The tokens of one text, stored contiguously and in order. The stream only
+ * views the text it was scanned from, which must outlive it. The last token
+ * is always kEndOfFile, with an empty span at the end of the text.
+ */
+class TokenStream {
+ public:
+    TokenStream() : text_(NULL), tokens_() {}
+
+    const char *text() const { return text_; }
+    size_t size() const { return tokens_.size(); }
+    const CompactToken &operator[](size_t i) const { return tokens_[i]; }
+
+    TokenType terminal(size_t i) const { return tokens_[i].terminal; }
+    const char *begin(size_t i) const { return text_ + tokens_[i].offset; }
+    std :: string lexeme(size_t i) const {
+        return std :: string(begin(i), tokens_[i].length);
+    }
+
+    /* Forget all tokens (keeping the storage) and view [text] instead */
+    void Reset(const char *text) {
+        text_ = text;
+        tokens_.clear();
+    }
+    void Add(TokenType terminal, size_t offset, uint32_t length) {
+        CompactToken t;
+        t.offset = offset;
+        t.length = length;
+        t.terminal = terminal;
+        tokens_.push_back(t);
+    }
+    /* Make room for [n] tokens, to be filled in with Set(). Different
+       threads may Set() different tokens at the same time */
+    void Resize(size_t n) { tokens_.resize(n); }
+    void Set(size_t i, const CompactToken &t) { tokens_[i] = t; }
+
+ private:
+    const char *text_;
+    std :: vector<CompactToken> tokens_;
+};
+
+/*
+ * The scanner's DFA tables are generated from kTokenSpecs and kSkipPatterns
+ * at build time (see lexgen.cc), so constructing a Scanner costs nothing and
+ * the tables are shared, read-only, by every Scanner in every thread.
+ *
+ * Every scan reads each byte of its input once, front to back. The
+ * length-bounded entries never look past the end of the buffer, so they work
+ * on text that is not NUL-terminated (an mmapped file, say); a NUL byte
+ * inside the buffer is simply a character that starts no token. The
+ * const char * entries take the length with one strlen.
+ *
+ * regexes[] holds the same patterns compiled with make_regex. It is only
+ * filled in by an explicit call to init_regex(); Scan does not use it.
+ */
 class Scanner {
  public:
+        /* Scan [text] into a linked list of Tokens, ending in kEndOfFile */
         Token *Scan(const char *);
+        /* Scan the [length] bytes at [begin]; no NUL terminator is needed */
+        Token *Scan(const char *begin, size_t length);
+        /* Scan [text] into [tokens], replacing its previous contents */
+        void Tokenize(const char *, TokenStream *tokens);
+        void Tokenize(const char *begin, size_t length, TokenStream *tokens);
+        /* The same, with the text cut into chunks of at least [min_chunk]
+           bytes that are scanned in parallel on [pool]. The tokens are
+           exactly those of the single-threaded scan. Must not be called
+           from one of the pool's own workers */
+        Token *Scan(const char *begin, size_t length, ThreadPool *pool);
+        void Tokenize(const char *begin, size_t length, TokenStream *tokens,
+                      ThreadPool *pool,
+                      size_t min_chunk = kMinParallelChunk);
         Result find_TokenType(const char *);
-        Scanner() {
-            init_regex();
+        /* The token at [text], looking no further than [end]. [stop], if
+           given, is set to the last byte looked at (see dfa_match) */
+        Result find_TokenType(const char *text, const char *end,
+                              const char **stop = NULL);
+
+        /* Pull interface: Start() on a text, then take tokens one at a
+           time with Next(). Tokens are scanned only when they are asked
+           for, and at most kLookahead of them are held at once. Once the
+           text is used up, every call returns kEndOfFile */
+        void Start(const char *begin, size_t length);
+        /* Go on from [offset] instead, which must be where a token or the
+           space before one begins; anything peeked at is dropped */
+        void Seek(size_t offset);
+        CompactToken Next();
+        /* The token [k] places ahead of the next one, without taking it */
+        const CompactToken &Peek(int k = 0);
+        /* The text passed to Start(), which token offsets refer to */
+        const char *text() const { return text_; }
+        std :: string lexeme(const CompactToken &t) const {
+            return std :: string(text_ + t.offset, t.length);
         }
+        /* One past the furthest offset that the tokens scanned since
+           Start() depend on; end of text + 1 once the scanner has had to
+           look for the end. Changing nothing before reach() changes none
+           of those tokens */
+        size_t reach() const { return reach_; }
+
+        Scanner() : text_(NULL), cursor_(NULL), end_(NULL), reach_(0),
+                    ring_head_(0), ring_size_(0) {
+            for (int i = 0; i <= kLexicalError; i++) {
+                regexes[i] = NULL;
+            }
+        }
+        ~Scanner();
         regex_t *regexes[kLexicalError + 1];
 
         void init_regex();
+
+        static const int kLookahead = 4;
+        static const size_t kMinParallelChunk = 1 << 20;
+
+ private:
+        CompactToken ScanToken();
+        void ScanOne();
+
+        const char *text_;
+        const char *cursor_;
+        const char *end_;
+        size_t reach_;
+        /* Scanned but not yet taken tokens, oldest at ring_head_ */
+        CompactToken ring_[kLookahead];
+        int ring_head_;
+        int ring_size_;
 };
 
 
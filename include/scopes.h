@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Name            : scopes.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the nested scopes that passes over an AST
+ *                   look names up in.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_SCOPES_H_
+#define PROJECT_INCLUDE_SCOPES_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <utility>
+#include <vector>
+#include "./symbol_table.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Scopes
+ * What each name is bound to, kept by symbol id so that a lookup is one
+ * index. A binding made while a scope is open replaces the one it hides
+ * until the scope is closed; bindings made outside every scope last.
+ * Unbound names, and the empty name, are bound to [none].
+ */
+template <typename Value>
+class Scopes {
+ public:
+  explicit Scopes(Value none) : none_(none), values_(), undo_(), marks_() {}
+
+  void Clear(void) {
+    values_.clear();
+    undo_.clear();
+    marks_.clear();
+  }
+
+  Value Lookup(Symbol name) const {
+    size_t id = name.id();
+    return (id < values_.size()) ? values_[id] : none_;
+  }
+
+  void Bind(Symbol name, Value value) {
+    if (name.empty()) {
+      return;
+    }
+    size_t id = name.id();
+    if (id >= values_.size()) {
+      values_.resize(id + 1, none_);
+    }
+    if (!marks_.empty()) {
+      undo_.push_back(std::make_pair(id, values_[id]));
+    }
+    values_[id] = value;
+  }
+
+  void Open(void) { marks_.push_back(undo_.size()); }
+
+  /* Puts back the bindings the innermost scope replaced. */
+  void Close(void) {
+    for (size_t i = undo_.size(); i > marks_.back(); i--) {
+      values_[undo_[i - 1].first] = undo_[i - 1].second;
+    }
+    undo_.resize(marks_.back());
+    marks_.pop_back();
+  }
+
+ private:
+  Value none_;
+  /* What each name is bound to, by symbol id */
+  std::vector<Value> values_;
+  /* The bindings that bindings in open scopes replaced, to put back */
+  std::vector<std::pair<size_t, Value> > undo_;
+  /* Where in undo_ each open scope starts */
+  std::vector<size_t> marks_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_SCOPES_H_ */
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Name            : simplifier.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the pass that folds constants and
+ *                   simplifies the expressions of an AST.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_SIMPLIFIER_H_
+#define PROJECT_INCLUDE_SIMPLIFIER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "./arena.h"
+#include "./ast.h"
+#include "./visitor.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Simplifier
+ * Rewrites the expressions of a tree into simpler ones that mean the same,
+ * so that less C++ is written for them:
+ *  - operators on constants are replaced by their result, as C++ would
+ *    compute it, unless it cannot be written as an FCAL constant (it is
+ *    negative, say, or an int division by zero);
+ *  - x * 1, 1 * x, x / 1, x - 0, and x + 0 or 0 + x for ints, become x;
+ *  - !True, !!x, True && x, if False then a else b and the like become
+ *    what they evaluate to, when that has the same type;
+ *  - parentheses are dropped where the meaning does not depend on them, and
+ *    added where a rewrite makes it depend on them.
+ *
+ * The tree must have been typed by a TypeChecker first: the rewrites that
+ * depend on types are only made where they are known. The nodes the pass
+ * makes are allocated in the arena the tree lives in. The tree no longer
+ * is the parse of its text afterwards, so it must not be given to
+ * Parser::Reparse().
+ */
+class Simplifier : public Walker<Simplifier> {
+ public:
+  /* Simplifies trees that live in [arena] */
+  explicit Simplifier(Arena *arena) : arena_(arena) {}
+
+  /* Simplifies the tree under [root] and returns what replaced it */
+  Node *Simplify(Node *root);
+
+  // The pass itself, run by Walk():
+  Node *VisitMulExpr(MulExpr *node) { return Arithmetic(node, '*'); }
+  Node *VisitDivExpr(DivExpr *node) { return Arithmetic(node, '/'); }
+  Node *VisitPlusExpr(PlusExpr *node) { return Arithmetic(node, '+'); }
+  Node *VisitMinusExpr(MinusExpr *node) { return Arithmetic(node, '-'); }
+  Node *VisitGreaterExpr(GreaterExpr *node) { return Compare(node); }
+  Node *VisitGreaterEqualExpr(GreaterEqualExpr *node) {
+    return Compare(node);
+  }
+  Node *VisitLessExpr(LessExpr *node) { return Compare(node); }
+  Node *VisitLessEqualExpr(LessEqualExpr *node) { return Compare(node); }
+  Node *VisitEqualEqualExpr(EqualEqualExpr *node) { return Compare(node); }
+  Node *VisitNotEqualExpr(NotEqualExpr *node) { return Compare(node); }
+  Node *VisitAndExpr(AndExpr *node) { return Logic(node, true); }
+  Node *VisitOrExpr(OrExpr *node) { return Logic(node, false); }
+  Node *VisitGroupExpr(GroupExpr *node) { return Place(node, node); }
+  Node *VisitIfExpr(IfExpr *node);
+  Node *VisitNotExpr(NotExpr *node);
+
+ private:
+  template <typename N>
+  Node *Arithmetic(N *node, char op) {
+    Expr *left = node->expr_left();
+    Expr *right = node->expr_right();
+    Expr *folded = Fold(op, left, right);
+    if (folded != NULL) {
+      return folded;
+    }
+    return Reduce(node, Identity(node, op, left, right));
+  }
+  template <typename N>
+  Node *Compare(N *node) {
+    Expr *folded = FoldCompare(node->kind(), node->expr_left(),
+                               node->expr_right());
+    return (folded != NULL) ? folded : node;
+  }
+  /* [unit] is the operand that leaves the other unchanged: True for && */
+  template <typename N>
+  Node *Logic(N *node, bool unit) {
+    return Reduce(node, LogicOperand(unit, node->expr_left(),
+                                     node->expr_right()));
+  }
+
+  /* [left] [op] [right] as a constant, or NULL if it cannot be one */
+  Expr *Fold(char op, Expr *left, Expr *right);
+  Expr *FoldCompare(NodeKind kind, Expr *left, Expr *right);
+  /* The operand [node] reduces to for being an identity, if it is one */
+  static Expr *Identity(Expr *node, char op, Expr *left, Expr *right);
+  static Expr *LogicOperand(bool unit, Expr *left, Expr *right);
+  /*
+   * What replaces [node] when it reduces to [operand], which is NULL if it
+   * does not: [operand] itself if it has the type of [node], or else
+   * [node] is kept.
+   */
+  Node *Reduce(Expr *node, Expr *operand);
+  /*
+   * Puts [expr] in the place of [node] in its parent, in parentheses if
+   * it needs them there and out of its own if it does not.
+   */
+  Expr *Place(Expr *node, Expr *expr);
+  Expr *Boolean(bool value);
+
+  Arena *arena_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_SIMPLIFIER_H_ */
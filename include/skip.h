@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Name            : skip.h
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : Header file for the vectorized skipping of whitespace and
+ *                   comments between tokens.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_SKIP_H_
+#define PROJECT_INCLUDE_SKIP_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/*
+ * The implementations of skip_whitespace_and_comments(). They all give the
+ * same answer; they differ in how many bytes they look at per step.
+ */
+enum SkipImpl {
+  kSkipScalar,  // one byte at a time
+  kSkipSse2,    // 16 bytes at a time
+  kSkipAvx2,    // 32 bytes at a time
+  kNumSkipImpls
+};
+
+/*******************************************************************************
+ * Forward Declarations
+ ******************************************************************************/
+/* Returns true if this CPU can run [impl]. */
+bool skip_impl_supported(SkipImpl impl);
+
+/* The fastest implementation this CPU supports, chosen once at startup. */
+SkipImpl best_skip_impl(void);
+
+/*
+ * skip_whitespace_and_comments() - Skip the whitespace, block comments and
+ * line comments at the start of [text, end), exactly as kSkipPatterns
+ * describe them, and return the number of bytes skipped. A comment that is
+ * not closed before [end] or before a NUL byte is not skipped, and neither
+ * is a block comment containing a backslash.
+ */
+size_t skip_whitespace_and_comments(const char *text, const char *end);
+size_t skip_whitespace_and_comments(const char *text, const char *end,
+                                    SkipImpl impl);
+
+/*
+ * find_any_byte() - Return the first byte in [p, end) equal to [a], [b] or
+ * [c], or [end] if there is none, using the best implementation.
+ */
+const char *find_any_byte(const char *p, const char *end, char a, char b,
+                          char c);
+
+} /* namespace scanner */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_SKIP_H_ */
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Name            : symbol_table.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the table of interned identifiers that
+ *                   the nodes of an AST refer to their names by.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_SYMBOL_TABLE_H_
+#define PROJECT_INCLUDE_SYMBOL_TABLE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <string>
+#include "./arena.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/*
+ * Names that code generation treats specially. Every SymbolTable interns
+ * them first, in this order, so they have the same ids in every table.
+ */
+enum BuiltinSymbol {
+  kNRowsSymbol = 0,
+  kNColsSymbol,
+  kMatrixReadSymbol,
+  kNumBuiltinSymbols
+};
+
+/* The id of the empty Symbol, which belongs to no table. */
+const int kNoSymbol = -1;
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/* One distinct name; lives in the arena of the table that made it. */
+struct SymbolEntry {
+  SymbolEntry(int id_in, unsigned hash_in, const char *text_in,
+              size_t length)
+      : id(id_in), hash(hash_in), text(text_in, length) {}
+
+  int id;
+  unsigned hash;
+  std::string text;
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Symbol
+ * A name interned in a SymbolTable. Two symbols from the same table are
+ * equal exactly when their names are, which takes one pointer comparison;
+ * symbols from different tables never compare equal. A Symbol is only
+ * valid while its table's arena is.
+ */
+class Symbol {
+ public:
+  Symbol(void) : entry_(&kEmptyEntry) {}
+
+  int id(void) const { return entry_->id; }
+  const std::string &str(void) const { return entry_->text; }
+  bool empty(void) const { return entry_ == &kEmptyEntry; }
+
+  bool operator==(const Symbol &other) const {
+    return entry_ == other.entry_;
+  }
+  bool operator!=(const Symbol &other) const {
+    return entry_ != other.entry_;
+  }
+
+ private:
+  friend class SymbolTable;
+  explicit Symbol(const SymbolEntry *entry) : entry_(entry) {}
+
+  static const SymbolEntry kEmptyEntry;
+
+  const SymbolEntry *entry_;
+};
+
+/*!
+ * SymbolTable
+ * Gives each distinct identifier of a parse one Symbol, numbered from 0 in
+ * the order the names were first seen. The names are copied into [arena]
+ * once each, however often they occur, and the table keeps its own arrays
+ * there too, so it never touches the heap for short names.
+ *
+ * Not thread-safe; every parse has its own table.
+ */
+class SymbolTable {
+ public:
+  explicit SymbolTable(Arena *arena);
+
+  /* The symbol for the [length] bytes at [text], adding it if it is new */
+  Symbol Intern(const char *text, size_t length);
+  Symbol Intern(const std::string &text) {
+    return Intern(text.data(), text.size());
+  }
+
+  /* The symbol numbered [id], for 0 <= id < size() */
+  Symbol symbol(int id) const { return Symbol(entries_[id]); }
+  int size(void) const { return size_; }
+
+ private:
+  SymbolTable(const SymbolTable &) = delete;
+  SymbolTable &operator=(const SymbolTable &) = delete;
+
+  void Grow(void);
+
+  Arena *arena_;
+  /* Indexed by id, with room for num_slots_ / 2 entries */
+  const SymbolEntry **entries_;
+  int size_;
+  /* Open-addressed hash table of ids; kNoSymbol marks an empty slot */
+  int *slots_;
+  size_t num_slots_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_SYMBOL_TABLE_H_ */
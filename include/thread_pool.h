@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Name            : thread_pool.h
+ * Project         : fcal
+ * Module          : util
+ * Description     : Header file for a fixed-size pool of worker threads.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_THREAD_POOL_H_
+#define PROJECT_INCLUDE_THREAD_POOL_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * ThreadPool
+ * A fixed set of worker threads that share out submitted tasks by work
+ * stealing. Each worker has a queue of its own: tasks submitted from outside
+ * are dealt out to the queues in turn, and tasks a worker submits go on its
+ * own queue. A worker runs the newest task on its queue, and when that is
+ * empty steals the oldest task from another's, so a worker that drew long
+ * tasks does not hold the others up.
+ *
+ * The threads are started once and live as long as the pool, so a pool can
+ * be shared by many jobs. Submit() may be called from any thread, Wait()
+ * from any thread except the workers themselves.
+ */
+class ThreadPool {
+ public:
+  /* Starts [num_threads] workers; 0 means one per hardware thread. */
+  explicit ThreadPool(int num_threads = 0);
+  ~ThreadPool(void);
+
+  int size(void) const { return static_cast<int>(workers_.size()); }
+
+  /*
+   * The number, from 0 to size() - 1, of the worker of this pool that is
+   * calling, or -1 if it is not one. Lets tasks keep per-worker state.
+   */
+  int worker_index(void) const;
+
+  /* Queues [task] to run on some worker. */
+  void Submit(std::function<void()> task);
+
+  /* Blocks until every task submitted so far has finished. */
+  void Wait(void);
+
+ private:
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()> > tasks;
+  };
+
+  void WorkerLoop(int index);
+  bool TakeTask(int index, std::function<void()> *task);
+
+  std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkQueue> > queues_;
+  /* The queue the next task from outside goes on */
+  std::atomic<unsigned> next_queue_;
+  /* Tasks on the queues, not yet taken */
+  std::atomic<int> queued_;
+
+  /* Guards pending_ and stopping_; idle workers sleep on work_ready_ */
+  std::mutex mutex_;
+  std::condition_variable work_ready_;
+  std::condition_variable work_done_;
+  int pending_;
+  bool stopping_;
+};
+
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_THREAD_POOL_H_ */
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Name            : type_checker.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the pass that finds the type of every
+ *                   expression of an AST.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_TYPE_CHECKER_H_
+#define PROJECT_INCLUDE_TYPE_CHECKER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <vector>
+#include "./ast.h"
+#include "./scopes.h"
+#include "./visitor.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/* The name of [type] as FCAL spells it, for messages */
+const char *TypeName(Type type);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * TypeChecker
+ * Sets the type of every expression of a tree from the declarations in
+ * scope and the types of its operands, and lists what does not type-check.
+ * Ints mix with floats, giving floats; matrices multiply; conditions are
+ * booleans. An ill-typed expression is left as kNoType, so that what is
+ * built on it is not checked again and reports nothing more.
+ *
+ * Blocks, let expressions and the indices of a long matrix declaration
+ * open scopes; a name declared in one is forgotten at its end. A
+ * TypeChecker can check any number of trees, one after another.
+ */
+class TypeChecker : public Walker<TypeChecker> {
+ public:
+  TypeChecker(void) : types_(kNoType), errors_() {}
+
+  /* Types the tree under [root], which is left otherwise unchanged. */
+  void Check(Node *root);
+
+  /* What did not type-check in the last tree, in the order it was found */
+  const std::vector<std::string> &errors(void) const { return errors_; }
+
+  // The pass itself, run by Walk():
+  bool Enter(Node *node);
+  Node *VisitVarExpr(VarExpr *node);
+  Node *VisitIntConstExpr(IntConstExpr *node) { return Typed(node, kIntType); }
+  Node *VisitFloatConstExpr(FloatConstExpr *node) {
+    return Typed(node, kFloatType);
+  }
+  Node *VisitStringConstExpr(StringConstExpr *node) {
+    return Typed(node, kStringType);
+  }
+  Node *VisitTrueExpr(TrueExpr *node) { return Typed(node, kBoolType); }
+  Node *VisitFalseExpr(FalseExpr *node) { return Typed(node, kBoolType); }
+  Node *VisitMulExpr(MulExpr *node);
+  Node *VisitDivExpr(DivExpr *node) { return Arithmetic(node, "/"); }
+  Node *VisitPlusExpr(PlusExpr *node) { return Arithmetic(node, "+"); }
+  Node *VisitMinusExpr(MinusExpr *node) { return Arithmetic(node, "-"); }
+  Node *VisitGreaterExpr(GreaterExpr *node) { return Compare(node, ">"); }
+  Node *VisitGreaterEqualExpr(GreaterEqualExpr *node) {
+    return Compare(node, ">=");
+  }
+  Node *VisitLessExpr(LessExpr *node) { return Compare(node, "<"); }
+  Node *VisitLessEqualExpr(LessEqualExpr *node) {
+    return Compare(node, "<=");
+  }
+  Node *VisitEqualEqualExpr(EqualEqualExpr *node) {
+    return Equate(node, "==");
+  }
+  Node *VisitNotEqualExpr(NotEqualExpr *node) { return Equate(node, "!="); }
+  Node *VisitAndExpr(AndExpr *node) { return Logic(node, "&&"); }
+  Node *VisitOrExpr(OrExpr *node) { return Logic(node, "||"); }
+  Node *VisitMatrixRefExpr(MatrixRefExpr *node);
+  Node *VisitFuncCallExpr(FuncCallExpr *node);
+  Node *VisitGroupExpr(GroupExpr *node) {
+    return Typed(node, node->expr()->type());
+  }
+  Node *VisitIfExpr(IfExpr *node);
+  Node *VisitNotExpr(NotExpr *node);
+  Node *VisitLetExpr(LetExpr *node);
+  Node *VisitIntDecl(IntDecl *node);
+  Node *VisitFloatDecl(FloatDecl *node);
+  Node *VisitStringDecl(StringDecl *node);
+  Node *VisitBooleanDecl(BooleanDecl *node);
+  Node *VisitShortMatrixDecl(ShortMatrixDecl *node);
+  Node *VisitLongMatrixDecl(LongMatrixDecl *node);
+  Node *VisitBlockStmt(BlockStmt *node);
+  Node *VisitIfStmt(IfStmt *node);
+  Node *VisitIfElseStmt(IfElseStmt *node);
+  Node *VisitAssignStmt(AssignStmt *node);
+  Node *VisitMatrixAssignStmt(MatrixAssignStmt *node);
+  Node *VisitRepeatStmt(RepeatStmt *node);
+  Node *VisitWhileStmt(WhileStmt *node);
+
+ private:
+  /* Sets the type of [node] and returns it, as the walk wants. */
+  Node *Typed(Expr *node, Type type) {
+    node->set_type(type);
+    return node;
+  }
+
+  template <typename N>
+  Node *Arithmetic(N *node, const char *op) {
+    Type left = node->expr_left()->type();
+    Type right = node->expr_right()->type();
+    return Typed(node, ArithmeticType(left, op, right));
+  }
+  template <typename N>
+  Node *Compare(N *node, const char *op) {
+    Type left = node->expr_left()->type();
+    Type right = node->expr_right()->type();
+    bool ok = Expect(IsNumber(left) && IsNumber(right), left, op, right);
+    return Typed(node, ok ? kBoolType : kNoType);
+  }
+  template <typename N>
+  Node *Equate(N *node, const char *op) {
+    Type left = node->expr_left()->type();
+    Type right = node->expr_right()->type();
+    bool ok = Expect(Unify(left, right) != kNoType &&
+                     Unify(left, right) != kMatrixType, left, op, right);
+    return Typed(node, ok ? kBoolType : kNoType);
+  }
+  template <typename N>
+  Node *Logic(N *node, const char *op) {
+    Type left = node->expr_left()->type();
+    Type right = node->expr_right()->type();
+    bool ok = Expect(left == kBoolType && right == kBoolType, left, op, right);
+    return Typed(node, ok ? kBoolType : kNoType);
+  }
+
+  static bool IsNumber(Type type) {
+    return type == kIntType || type == kFloatType;
+  }
+  /* The type two operands are brought to: float if either is a float */
+  static Type Unify(Type left, Type right);
+  Type ArithmeticType(Type left, const char *op, Type right);
+  /*
+   * Reports an operator that does not apply to [left] and [right] unless
+   * [ok], or either of them is already ill-typed; returns [ok].
+   */
+  bool Expect(bool ok, Type left, const char *op, Type right);
+  /* Reports [what] unless [type] is [expected] or already ill-typed. */
+  void ExpectType(Type type, Type expected, const std::string &what);
+  void Error(const std::string &message) { errors_.push_back(message); }
+
+  Type Lookup(Symbol name) { return types_.Lookup(name); }
+  void Declare(Symbol name, Type type) { types_.Bind(name, type); }
+  void OpenScope(void) { types_.Open(); }
+  void CloseScope(void) { types_.Close(); }
+
+  /* The type each name in scope is declared with */
+  Scopes<Type> types_;
+  std::vector<std::string> errors_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_TYPE_CHECKER_H_ */
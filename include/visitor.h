@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Name            : visitor.h
+ * Project         : fcal
+ * Module          : ast
+ * Description     : Header file for the visitors and walkers that passes over
+ *                   an AST are written with.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+#ifndef PROJECT_INCLUDE_VISITOR_H_
+#define PROJECT_INCLUDE_VISITOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stddef.h>
+#include <vector>
+#include "./ast.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* The most children any node but a Stmts has */
+const size_t kMaxChildren = 3;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * The children of [node], in the order they appear in its text: the
+ * statements of a Stmts, the operands of an operator, and so on. Names are
+ * not children; missing ones are NULL.
+ *
+ * Children() returns how many there are and, unless [node] is a Stmts,
+ * stores them all in [children], which has room for kMaxChildren.
+ */
+size_t Children(Node *node, Node **children);
+size_t NumChildren(Node *node);
+Node *Child(Node *node, size_t i);
+/* Puts [child], which is not NULL, in place of the [i]th child of [node]. */
+void SetChild(Node *node, size_t i, Node *child);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * Visitor
+ * Calls the VisitX() method of [Derived] that matches the kind of a node,
+ * with the node cast to its class X. Dispatch is a switch on Node::kind(),
+ * resolved at compile time for each pass, not a virtual call.
+ *
+ * A pass defines only the VisitX() methods it cares about. The others fall
+ * back to VisitExpr(), VisitDecl() or VisitStmt() for the class they derive
+ * from, and from there to VisitNode(), which does nothing.
+ */
+template <typename Derived, typename Result = void>
+class Visitor {
+ public:
+  Result Visit(Node *node) {
+    switch (node->kind()) {
+#define FCAL_VISIT_KIND(name, base) \
+      case k##name: return derived()->Visit##name(static_cast<name *>(node));
+      FCAL_AST_NODES(FCAL_VISIT_KIND)
+#undef FCAL_VISIT_KIND
+      default: return derived()->VisitNode(node);
+    }
+  }
+
+#define FCAL_VISIT_DEFAULT(name, base) \
+  Result Visit##name(name *node) { return derived()->Visit##base(node); }
+  FCAL_AST_NODES(FCAL_VISIT_DEFAULT)
+#undef FCAL_VISIT_DEFAULT
+  Result VisitExpr(Expr *node) { return derived()->VisitNode(node); }
+  Result VisitDecl(Decl *node) { return derived()->VisitNode(node); }
+  Result VisitStmt(Stmt *node) { return derived()->VisitNode(node); }
+  Result VisitNode(Node *) { return Result(); }
+
+ protected:
+  Derived *derived(void) { return static_cast<Derived *>(this); }
+};
+
+/*!
+ * Walker
+ * Walks a whole tree, children before their parent, on a stack of its own,
+ * so a tree of any depth is walked without recursion. Before the children of
+ * a node are walked, Enter() is called on it; if it returns false they are
+ * skipped. Then the node is visited, and whatever VisitX() returns takes its
+ * place in its parent: a read-only pass returns the node it was given, which
+ * VisitNode() does by default, while a rewriting pass returns the node that
+ * replaces it.
+ */
+template <typename Derived>
+class Walker : public Visitor<Derived, Node *> {
+ public:
+  Walker(void) : path_() {}
+
+  /* Walks the tree under [root] and returns what replaced it, if anything */
+  Node *Walk(Node *root) {
+    if (root == NULL) {
+      return NULL;
+    }
+    size_t base = path_.size();
+    Push(root);
+    while (true) {
+      Step &top = path_.back();
+      if (top.next < top.size) {
+        Node *child = (top.list != NULL) ? top.list->stmt(top.next)
+                                         : top.children[top.next];
+        top.next++;
+        if (child != NULL) {
+          Push(child);
+        }
+        continue;
+      }
+      Node *node = top.node;
+      path_.pop_back();
+      Node *result = this->Visit(node);
+      if (path_.size() == base) {
+        return result;
+      }
+      if (result != node) {
+        SetChild(path_.back().node, path_.back().next - 1, result);
+      }
+    }
+  }
+
+  bool Enter(Node *) { return true; }
+  Node *VisitNode(Node *node) { return node; }
+
+ protected:
+  /* The parent of the node being entered or visited, if it has one */
+  Node *parent(void) const { return path_.empty() ? NULL : path_.back().node; }
+
+ private:
+  /*
+   * A node on the path, and the next of its [size] children to walk: the
+   * statements of [list] if it is a Stmts, or else [children].
+   */
+  struct Step {
+    Node *node;
+    size_t next;
+    size_t size;
+    Stmts *list;
+    Node *children[kMaxChildren];
+  };
+
+  void Push(Node *node) {
+    bool enter = this->derived()->Enter(node);
+    path_.emplace_back();
+    Step &step = path_.back();
+    step.node = node;
+    step.next = 0;
+    step.size = enter ? Children(node, step.children) : 0;
+    step.list = (node->kind() == kStmts) ? static_cast<Stmts *>(node) : NULL;
+  }
+
+  std::vector<Step> path_;
+};
+
+} /* namespace ast */
+} /* namespace fcal */
+
+#endif /* PROJECT_INCLUDE_VISITOR_H_ */
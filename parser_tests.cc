@@ -0,0 +1,177 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_ParserTestSuite_init = false;
+#include "/root/repo/tests/parser_tests.h"
+
+static ParserTestSuite suite_ParserTestSuite;
+
+static CxxTest::List Tests_ParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParserTestSuite( "tests/parser_tests.h", 29, "ParserTestSuite", suite_ParserTestSuite, Tests_ParserTestSuite );
+
+static class TestDescription_suite_ParserTestSuite_test_setup_code : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_setup_code() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 33, "test_setup_code" ) {}
+ void runTest() { suite_ParserTestSuite.test_setup_code(); }
+} testDescription_suite_ParserTestSuite_test_setup_code;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_bad_syntax : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_bad_syntax() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 38, "test_parse_bad_syntax" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_bad_syntax(); }
+} testDescription_suite_ParserTestSuite_test_parse_bad_syntax;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_sample_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_sample_1() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 46, "test_parse_sample_1" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_sample_1(); }
+} testDescription_suite_ParserTestSuite_test_parse_sample_1;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_sample_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_sample_2() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 56, "test_parse_sample_2" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_sample_2(); }
+} testDescription_suite_ParserTestSuite_test_parse_sample_2;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_sample_3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_sample_3() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 66, "test_parse_sample_3" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_sample_3(); }
+} testDescription_suite_ParserTestSuite_test_parse_sample_3;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_sample_4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_sample_4() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 76, "test_parse_sample_4" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_sample_4(); }
+} testDescription_suite_ParserTestSuite_test_parse_sample_4;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_sample_5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_sample_5() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 86, "test_parse_sample_5" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_sample_5(); }
+} testDescription_suite_ParserTestSuite_test_parse_sample_5;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_mysample : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_mysample() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 102, "test_parse_mysample" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_mysample(); }
+} testDescription_suite_ParserTestSuite_test_parse_mysample;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_forestLossV2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_forestLossV2() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 112, "test_parse_forestLossV2" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_forestLossV2(); }
+} testDescription_suite_ParserTestSuite_test_parse_forestLossV2;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_result_owns_tree : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_result_owns_tree() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 122, "test_parse_result_owns_tree" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_result_owns_tree(); }
+} testDescription_suite_ParserTestSuite_test_parse_result_owns_tree;
+
+static class TestDescription_suite_ParserTestSuite_test_failed_parse_keeps_no_tree : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_failed_parse_keeps_no_tree() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 135, "test_failed_parse_keeps_no_tree" ) {}
+ void runTest() { suite_ParserTestSuite.test_failed_parse_keeps_no_tree(); }
+} testDescription_suite_ParserTestSuite_test_failed_parse_keeps_no_tree;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_reports_every_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_reports_every_error() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 151, "test_parse_reports_every_error" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_reports_every_error(); }
+} testDescription_suite_ParserTestSuite_test_parse_reports_every_error;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_recovers_at_end_of_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_recovers_at_end_of_file() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 175, "test_parse_recovers_at_end_of_file" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_recovers_at_end_of_file(); }
+} testDescription_suite_ParserTestSuite_test_parse_recovers_at_end_of_file;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_recovers_past_broken_block_header : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_recovers_past_broken_block_header() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 183, "test_parse_recovers_past_broken_block_header" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_recovers_past_broken_block_header(); }
+} testDescription_suite_ParserTestSuite_test_parse_recovers_past_broken_block_header;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_long_and_deep_programs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_long_and_deep_programs() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 202, "test_parse_long_and_deep_programs" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_long_and_deep_programs(); }
+} testDescription_suite_ParserTestSuite_test_parse_long_and_deep_programs;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_not_expr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_not_expr() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 230, "test_parse_not_expr" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_not_expr(); }
+} testDescription_suite_ParserTestSuite_test_parse_not_expr;
+
+static class TestDescription_suite_ParserTestSuite_test_arena_reset_runs_destructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_arena_reset_runs_destructors() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 238, "test_arena_reset_runs_destructors" ) {}
+ void runTest() { suite_ParserTestSuite.test_arena_reset_runs_destructors(); }
+} testDescription_suite_ParserTestSuite_test_arena_reset_runs_destructors;
+
+static class TestDescription_suite_ParserTestSuite_test_parser_recycles_arena : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parser_recycles_arena() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 270, "test_parser_recycles_arena" ) {}
+ void runTest() { suite_ParserTestSuite.test_parser_recycles_arena(); }
+} testDescription_suite_ParserTestSuite_test_parser_recycles_arena;
+
+static class TestDescription_suite_ParserTestSuite_test_reparse_reuses_untouched_statements : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_reparse_reuses_untouched_statements() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 304, "test_reparse_reuses_untouched_statements" ) {}
+ void runTest() { suite_ParserTestSuite.test_reparse_reuses_untouched_statements(); }
+} testDescription_suite_ParserTestSuite_test_reparse_reuses_untouched_statements;
+
+static class TestDescription_suite_ParserTestSuite_test_reparse_rereads_lookahead : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_reparse_rereads_lookahead() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 328, "test_reparse_rereads_lookahead" ) {}
+ void runTest() { suite_ParserTestSuite.test_reparse_rereads_lookahead(); }
+} testDescription_suite_ParserTestSuite_test_reparse_rereads_lookahead;
+
+static class TestDescription_suite_ParserTestSuite_test_reparse_through_errors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_reparse_through_errors() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 345, "test_reparse_through_errors" ) {}
+ void runTest() { suite_ParserTestSuite.test_reparse_through_errors(); }
+} testDescription_suite_ParserTestSuite_test_reparse_through_errors;
+
+static class TestDescription_suite_ParserTestSuite_test_parse_many_keeps_order : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_parse_many_keeps_order() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 387, "test_parse_many_keeps_order" ) {}
+ void runTest() { suite_ParserTestSuite.test_parse_many_keeps_order(); }
+} testDescription_suite_ParserTestSuite_test_parse_many_keeps_order;
+
+static class TestDescription_suite_ParserTestSuite_test_translate_many : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_translate_many() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 409, "test_translate_many" ) {}
+ void runTest() { suite_ParserTestSuite.test_translate_many(); }
+} testDescription_suite_ParserTestSuite_test_translate_many;
+
+static class TestDescription_suite_ParserTestSuite_test_translate_many_reports_type_errors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParserTestSuite_test_translate_many_reports_type_errors() : CxxTest::RealTestDescription( Tests_ParserTestSuite, suiteDescription_ParserTestSuite, 438, "test_translate_many_reports_type_errors" ) {}
+ void runTest() { suite_ParserTestSuite.test_translate_many_reports_type_errors(); }
+} testDescription_suite_ParserTestSuite_test_translate_many_reports_type_errors;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
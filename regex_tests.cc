@@ -0,0 +1,75 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_RegexTestSuite_init = false;
+#include "/root/repo/tests/regex_tests.h"
+
+static RegexTestSuite suite_RegexTestSuite;
+
+static CxxTest::List Tests_RegexTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegexTestSuite( "tests/regex_tests.h", 11, "RegexTestSuite", suite_RegexTestSuite, Tests_RegexTestSuite );
+
+static class TestDescription_suite_RegexTestSuite_test_make_matchRegex_match : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_make_matchRegex_match() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 20, "test_make_matchRegex_match" ) {}
+ void runTest() { suite_RegexTestSuite.test_make_matchRegex_match(); }
+} testDescription_suite_RegexTestSuite_test_make_matchRegex_match;
+
+static class TestDescription_suite_RegexTestSuite_test_make_matchRegex_no_match : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_make_matchRegex_no_match() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 27, "test_make_matchRegex_no_match" ) {}
+ void runTest() { suite_RegexTestSuite.test_make_matchRegex_no_match(); }
+} testDescription_suite_RegexTestSuite_test_make_matchRegex_no_match;
+
+static class TestDescription_suite_RegexTestSuite_test_make_matchRegex_match_string_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_make_matchRegex_match_string_copy() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 34, "test_make_matchRegex_match_string_copy" ) {}
+ void runTest() { suite_RegexTestSuite.test_make_matchRegex_match_string_copy(); }
+} testDescription_suite_RegexTestSuite_test_make_matchRegex_match_string_copy;
+
+static class TestDescription_suite_RegexTestSuite_test_make_regex_bad_pattern : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_make_regex_bad_pattern() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 46, "test_make_regex_bad_pattern" ) {}
+ void runTest() { suite_RegexTestSuite.test_make_regex_bad_pattern(); }
+} testDescription_suite_RegexTestSuite_test_make_regex_bad_pattern;
+
+static class TestDescription_suite_RegexTestSuite_test_match_regex_longest : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_match_regex_longest() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 51, "test_match_regex_longest" ) {}
+ void runTest() { suite_RegexTestSuite.test_match_regex_longest(); }
+} testDescription_suite_RegexTestSuite_test_match_regex_longest;
+
+static class TestDescription_suite_RegexTestSuite_test_match_regex_always_anchored : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_match_regex_always_anchored() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 60, "test_match_regex_always_anchored" ) {}
+ void runTest() { suite_RegexTestSuite.test_match_regex_always_anchored(); }
+} testDescription_suite_RegexTestSuite_test_match_regex_always_anchored;
+
+static class TestDescription_suite_RegexTestSuite_test_match_regex_cache_flush : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegexTestSuite_test_match_regex_cache_flush() : CxxTest::RealTestDescription( Tests_RegexTestSuite, suiteDescription_RegexTestSuite, 68, "test_match_regex_cache_flush" ) {}
+ void runTest() { suite_RegexTestSuite.test_match_regex_cache_flush(); }
+} testDescription_suite_RegexTestSuite_test_match_regex_cache_flush;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
@@ -0,0 +1,903 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_ScannerTestSuite_init = false;
+#include "/root/repo/tests/scanner_tests.h"
+
+static ScannerTestSuite suite_ScannerTestSuite;
+
+static CxxTest::List Tests_ScannerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScannerTestSuite( "tests/scanner_tests.h", 21, "ScannerTestSuite", suite_ScannerTestSuite, Tests_ScannerTestSuite );
+
+static class TestDescription_suite_ScannerTestSuite_test_setup_code : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_setup_code() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 29, "test_setup_code" ) {}
+ void runTest() { suite_ScannerTestSuite.test_setup_code(); }
+} testDescription_suite_ScannerTestSuite_test_setup_code;
+
+static class TestDescription_suite_ScannerTestSuite_test_intKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_intKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 48, "test_intKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_intKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_intKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_floatKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_floatKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 54, "test_floatKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_floatKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_floatKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_stringKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_stringKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 60, "test_stringKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_stringKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_stringKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_matrixKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_matrixKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 66, "test_matrixKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_matrixKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_matrixKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_letKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_letKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 72, "test_letKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_letKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_letKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_inKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_inKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 78, "test_inKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_inKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_inKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_endKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_endKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 84, "test_endKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_endKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_endKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_ifKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_ifKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 90, "test_ifKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_ifKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_ifKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_thenKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_thenKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 96, "test_thenKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_thenKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_thenKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_elseKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_elseKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 102, "test_elseKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_elseKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_elseKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_repeatKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_repeatKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 108, "test_repeatKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_repeatKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_repeatKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_printKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_printKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 114, "test_printKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_printKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_printKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_toKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_toKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 120, "test_toKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_toKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_toKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_trueKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_trueKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 126, "test_trueKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_trueKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_trueKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_falseKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_falseKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 132, "test_falseKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_falseKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_falseKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_whileKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_whileKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 138, "test_whileKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_whileKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_whileKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_boolKwd_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_boolKwd_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 144, "test_boolKwd_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_boolKwd_regex(); }
+} testDescription_suite_ScannerTestSuite_test_boolKwd_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_intConst_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_intConst_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 152, "test_intConst_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_intConst_regex(); }
+} testDescription_suite_ScannerTestSuite_test_intConst_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_floatConst_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_floatConst_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 158, "test_floatConst_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_floatConst_regex(); }
+} testDescription_suite_ScannerTestSuite_test_floatConst_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_stringConst_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_stringConst_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 164, "test_stringConst_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_stringConst_regex(); }
+} testDescription_suite_ScannerTestSuite_test_stringConst_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_varName_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_varName_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 170, "test_varName_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_varName_regex(); }
+} testDescription_suite_ScannerTestSuite_test_varName_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftParen_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftParen_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 178, "test_leftParen_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftParen_regex(); }
+} testDescription_suite_ScannerTestSuite_test_leftParen_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightParen_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightParen_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 184, "test_rightParen_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightParen_regex(); }
+} testDescription_suite_ScannerTestSuite_test_rightParen_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftCur_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftCur_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 190, "test_leftCur_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftCur_regex(); }
+} testDescription_suite_ScannerTestSuite_test_leftCur_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightCur_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightCur_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 196, "test_rightCur_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightCur_regex(); }
+} testDescription_suite_ScannerTestSuite_test_rightCur_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftSquar_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftSquar_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 202, "test_leftSquar_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftSquar_regex(); }
+} testDescription_suite_ScannerTestSuite_test_leftSquar_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightSquar_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightSquar_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 208, "test_rightSquar_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightSquar_regex(); }
+} testDescription_suite_ScannerTestSuite_test_rightSquar_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_semiCol_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_semiCol_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 214, "test_semiCol_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_semiCol_regex(); }
+} testDescription_suite_ScannerTestSuite_test_semiCol_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_colon_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_colon_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 220, "test_colon_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_colon_regex(); }
+} testDescription_suite_ScannerTestSuite_test_colon_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_assign_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_assign_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 228, "test_assign_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_assign_regex(); }
+} testDescription_suite_ScannerTestSuite_test_assign_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_plus_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_plus_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 234, "test_plus_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_plus_regex(); }
+} testDescription_suite_ScannerTestSuite_test_plus_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_star_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_star_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 240, "test_star_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_star_regex(); }
+} testDescription_suite_ScannerTestSuite_test_star_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_forwarsSlash_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_forwarsSlash_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 246, "test_forwarsSlash_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_forwarsSlash_regex(); }
+} testDescription_suite_ScannerTestSuite_test_forwarsSlash_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_lessThan_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lessThan_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 252, "test_lessThan_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lessThan_regex(); }
+} testDescription_suite_ScannerTestSuite_test_lessThan_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_lessThanEqual_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lessThanEqual_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 258, "test_lessThanEqual_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lessThanEqual_regex(); }
+} testDescription_suite_ScannerTestSuite_test_lessThanEqual_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_greaterThan_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_greaterThan_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 264, "test_greaterThan_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_greaterThan_regex(); }
+} testDescription_suite_ScannerTestSuite_test_greaterThan_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_greaterThanEqual_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_greaterThanEqual_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 270, "test_greaterThanEqual_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_greaterThanEqual_regex(); }
+} testDescription_suite_ScannerTestSuite_test_greaterThanEqual_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_equalEquals_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_equalEquals_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 276, "test_equalEquals_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_equalEquals_regex(); }
+} testDescription_suite_ScannerTestSuite_test_equalEquals_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_notEquals_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_notEquals_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 282, "test_notEquals_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_notEquals_regex(); }
+} testDescription_suite_ScannerTestSuite_test_notEquals_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_andOp_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_andOp_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 288, "test_andOp_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_andOp_regex(); }
+} testDescription_suite_ScannerTestSuite_test_andOp_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_orOp_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_orOp_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 294, "test_orOp_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_orOp_regex(); }
+} testDescription_suite_ScannerTestSuite_test_orOp_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_notOp_regex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_notOp_regex() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 300, "test_notOp_regex" ) {}
+ void runTest() { suite_ScannerTestSuite.test_notOp_regex(); }
+} testDescription_suite_ScannerTestSuite_test_notOp_regex;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_intKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_intKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 312, "test_terminal_intKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_intKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_intKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_floatKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_floatKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 318, "test_terminal_floatKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_floatKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_floatKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_stringKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_stringKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 324, "test_terminal_stringKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_stringKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_stringKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_matrixKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_matrixKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 330, "test_terminal_matrixKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_matrixKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_matrixKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_letKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_letKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 336, "test_terminal_letKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_letKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_letKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_inKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_inKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 342, "test_terminal_inKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_inKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_inKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_endKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_endKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 348, "test_terminal_endKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_endKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_endKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_ifKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_ifKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 354, "test_terminal_ifKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_ifKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_ifKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_thenKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_thenKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 360, "test_terminal_thenKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_thenKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_thenKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_elseKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_elseKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 366, "test_terminal_elseKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_elseKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_elseKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_repeatKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_repeatKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 372, "test_terminal_repeatKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_repeatKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_repeatKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_printKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_printKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 378, "test_terminal_printKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_printKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_printKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_toKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_toKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 384, "test_terminal_toKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_toKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_toKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_falseKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_falseKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 390, "test_terminal_falseKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_falseKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_falseKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_trueKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_trueKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 396, "test_terminal_trueKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_trueKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_trueKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_whileKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_whileKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 402, "test_terminal_whileKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_whileKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_whileKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_booleanKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_booleanKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 408, "test_terminal_booleanKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_booleanKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_booleanKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_intConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_intConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 416, "test_terminal_intConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_intConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_intConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_floatConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_floatConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 423, "test_terminal_floatConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_floatConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_floatConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_stringConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_stringConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 429, "test_terminal_stringConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_stringConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_stringConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_varName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_varName() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 435, "test_terminal_varName" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_varName(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_varName;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftParen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftParen() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 443, "test_terminal_leftParen" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftParen(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftParen;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightParen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightParen() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 449, "test_terminal_rightParen" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightParen(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightParen;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftCur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftCur() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 455, "test_terminal_leftCur" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftCur(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftCur;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightCur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightCur() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 461, "test_terminal_rightCur" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightCur(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightCur;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftSquar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftSquar() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 467, "test_terminal_leftSquar" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftSquar(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftSquar;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightSquar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightSquar() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 473, "test_terminal_rightSquar" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightSquar(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightSquar;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_semiColon : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_semiColon() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 479, "test_terminal_semiColon" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_semiColon(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_semiColon;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_Colon : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_Colon() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 485, "test_terminal_Colon" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_Colon(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_Colon;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_Assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_Assign() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 493, "test_terminal_Assign" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_Assign(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_Assign;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_Star : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_Star() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 499, "test_terminal_Star" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_Star(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_Star;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_Dash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_Dash() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 505, "test_terminal_Dash" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_Dash(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_Dash;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_ForwardSlash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_ForwardSlash() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 511, "test_terminal_ForwardSlash" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_ForwardSlash(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_ForwardSlash;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_lessThan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_lessThan() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 517, "test_terminal_lessThan" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_lessThan(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_lessThan;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 523, "test_terminal_lessThanEqual" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_lessThanEqual(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_greaterThan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_greaterThan() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 529, "test_terminal_greaterThan" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_greaterThan(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_greaterThan;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 535, "test_terminal_greaterThanEqual" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_greaterThanEqual(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_equalEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_equalEquals() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 541, "test_terminal_equalEquals" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_equalEquals(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_equalEquals;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_notEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_notEquals() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 547, "test_terminal_notEquals" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_notEquals(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_notEquals;
+
+static class TestDescription_suite_ScannerTestSuite_test_find_andOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_find_andOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 553, "test_find_andOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_find_andOp(); }
+} testDescription_suite_ScannerTestSuite_test_find_andOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_orOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_orOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 559, "test_terminal_orOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_orOp(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_orOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_NotOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_NotOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 565, "test_terminal_NotOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_NotOp(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_NotOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_keyword_prefix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_keyword_prefix() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 573, "test_terminal_keyword_prefix" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_keyword_prefix(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_keyword_prefix;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_longest_float : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_longest_float() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 578, "test_terminal_longest_float" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_longest_float(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_longest_float;
+
+static class TestDescription_suite_ScannerTestSuite_test_lookup_keyword : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lookup_keyword() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 583, "test_lookup_keyword" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lookup_keyword(); }
+} testDescription_suite_ScannerTestSuite_test_lookup_keyword;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_no_match : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_no_match() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 596, "test_terminal_no_match" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_no_match(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_no_match;
+
+static class TestDescription_suite_ScannerTestSuite_test_intKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_intKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 639, "test_intKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_intKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_intKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_floatKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_floatKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 642, "test_floatKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_floatKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_floatKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_stringKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_stringKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 645, "test_stringKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_stringKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_stringKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_matrixKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_matrixKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 648, "test_matrixKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_matrixKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_matrixKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_letKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_letKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 651, "test_letKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_letKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_letKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_inKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_inKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 654, "test_inKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_inKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_inKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_endKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_endKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 657, "test_endKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_endKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_endKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_ifKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_ifKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 660, "test_ifKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_ifKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_ifKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_thenKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_thenKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 663, "test_thenKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_thenKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_thenKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_elseKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_elseKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 666, "test_elseKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_elseKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_elseKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_repeatKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_repeatKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 669, "test_repeatKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_repeatKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_repeatKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_PrintKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_PrintKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 672, "test_PrintKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_PrintKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_PrintKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_ToKwd_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_ToKwd_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 675, "test_ToKwd_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_ToKwd_token(); }
+} testDescription_suite_ScannerTestSuite_test_ToKwd_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_intConst_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_intConst_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 678, "test_intConst_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_intConst_token(); }
+} testDescription_suite_ScannerTestSuite_test_intConst_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_floatConst_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_floatConst_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 681, "test_floatConst_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_floatConst_token(); }
+} testDescription_suite_ScannerTestSuite_test_floatConst_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_stringConst_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_stringConst_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 684, "test_stringConst_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_stringConst_token(); }
+} testDescription_suite_ScannerTestSuite_test_stringConst_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_varName_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_varName_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 687, "test_varName_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_varName_token(); }
+} testDescription_suite_ScannerTestSuite_test_varName_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftParen_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftParen_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 690, "test_leftParen_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftParen_token(); }
+} testDescription_suite_ScannerTestSuite_test_leftParen_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightParen_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightParen_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 693, "test_rightParen_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightParen_token(); }
+} testDescription_suite_ScannerTestSuite_test_rightParen_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftCur_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftCur_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 696, "test_leftCur_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftCur_token(); }
+} testDescription_suite_ScannerTestSuite_test_leftCur_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightCur_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightCur_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 699, "test_rightCur_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightCur_token(); }
+} testDescription_suite_ScannerTestSuite_test_rightCur_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_leftSquare_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_leftSquare_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 702, "test_leftSquare_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_leftSquare_token(); }
+} testDescription_suite_ScannerTestSuite_test_leftSquare_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_rightSquare_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_rightSquare_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 705, "test_rightSquare_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_rightSquare_token(); }
+} testDescription_suite_ScannerTestSuite_test_rightSquare_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_semiCol_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_semiCol_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 708, "test_semiCol_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_semiCol_token(); }
+} testDescription_suite_ScannerTestSuite_test_semiCol_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_colon_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_colon_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 711, "test_colon_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_colon_token(); }
+} testDescription_suite_ScannerTestSuite_test_colon_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_assign_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_assign_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 714, "test_assign_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_assign_token(); }
+} testDescription_suite_ScannerTestSuite_test_assign_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_plus_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_plus_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 717, "test_plus_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_plus_token(); }
+} testDescription_suite_ScannerTestSuite_test_plus_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_star_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_star_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 720, "test_star_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_star_token(); }
+} testDescription_suite_ScannerTestSuite_test_star_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_dash_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_dash_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 723, "test_dash_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_dash_token(); }
+} testDescription_suite_ScannerTestSuite_test_dash_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_forwardSlash_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_forwardSlash_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 726, "test_forwardSlash_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_forwardSlash_token(); }
+} testDescription_suite_ScannerTestSuite_test_forwardSlash_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_lessThan_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lessThan_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 729, "test_lessThan_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lessThan_token(); }
+} testDescription_suite_ScannerTestSuite_test_lessThan_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_lessThanEqual_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lessThanEqual_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 732, "test_lessThanEqual_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lessThanEqual_token(); }
+} testDescription_suite_ScannerTestSuite_test_lessThanEqual_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_greaterThan_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_greaterThan_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 735, "test_greaterThan_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_greaterThan_token(); }
+} testDescription_suite_ScannerTestSuite_test_greaterThan_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_greaterThanEqual_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_greaterThanEqual_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 738, "test_greaterThanEqual_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_greaterThanEqual_token(); }
+} testDescription_suite_ScannerTestSuite_test_greaterThanEqual_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_equalEquals_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_equalEquals_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 741, "test_equalEquals_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_equalEquals_token(); }
+} testDescription_suite_ScannerTestSuite_test_equalEquals_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_notEquals_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_notEquals_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 744, "test_notEquals_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_notEquals_token(); }
+} testDescription_suite_ScannerTestSuite_test_notEquals_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_andOp_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_andOp_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 747, "test_andOp_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_andOp_token(); }
+} testDescription_suite_ScannerTestSuite_test_andOp_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_orOp_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_orOp_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 750, "test_orOp_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_orOp_token(); }
+} testDescription_suite_ScannerTestSuite_test_orOp_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_notOp_token : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_notOp_token() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 753, "test_notOp_token" ) {}
+ void runTest() { suite_ScannerTestSuite.test_notOp_token(); }
+} testDescription_suite_ScannerTestSuite_test_notOp_token;
+
+static class TestDescription_suite_ScannerTestSuite_test_kEndOfFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_kEndOfFile() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 771, "test_kEndOfFile" ) {}
+ void runTest() { suite_ScannerTestSuite.test_kEndOfFile(); }
+} testDescription_suite_ScannerTestSuite_test_kEndOfFile;
+
+static class TestDescription_suite_ScannerTestSuite_test_lexicalError : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_lexicalError() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 791, "test_lexicalError" ) {}
+ void runTest() { suite_ScannerTestSuite.test_lexicalError(); }
+} testDescription_suite_ScannerTestSuite_test_lexicalError;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_empty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_empty() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 866, "test_scan_empty" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_empty(); }
+} testDescription_suite_ScannerTestSuite_test_scan_empty;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_empty_comment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_empty_comment() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 873, "test_scan_empty_comment" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_empty_comment(); }
+} testDescription_suite_ScannerTestSuite_test_scan_empty_comment;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_lexicalErrors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_lexicalErrors() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 882, "test_scan_lexicalErrors" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_lexicalErrors(); }
+} testDescription_suite_ScannerTestSuite_test_scan_lexicalErrors;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_nums_vars : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_nums_vars() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 904, "test_scan_nums_vars" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_nums_vars(); }
+} testDescription_suite_ScannerTestSuite_test_scan_nums_vars;
+
+static class TestDescription_suite_ScannerTestSuite_test_tokenize_spans : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_tokenize_spans() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 913, "test_tokenize_spans" ) {}
+ void runTest() { suite_ScannerTestSuite.test_tokenize_spans(); }
+} testDescription_suite_ScannerTestSuite_test_tokenize_spans;
+
+static class TestDescription_suite_ScannerTestSuite_test_tokenize_bounded : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_tokenize_bounded() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 930, "test_tokenize_bounded" ) {}
+ void runTest() { suite_ScannerTestSuite.test_tokenize_bounded(); }
+} testDescription_suite_ScannerTestSuite_test_tokenize_bounded;
+
+static class TestDescription_suite_ScannerTestSuite_test_skip_impls : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_skip_impls() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 951, "test_skip_impls" ) {}
+ void runTest() { suite_ScannerTestSuite.test_skip_impls(); }
+} testDescription_suite_ScannerTestSuite_test_skip_impls;
+
+static class TestDescription_suite_ScannerTestSuite_test_find_split_points : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_find_split_points() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 980, "test_find_split_points" ) {}
+ void runTest() { suite_ScannerTestSuite.test_find_split_points(); }
+} testDescription_suite_ScannerTestSuite_test_find_split_points;
+
+static class TestDescription_suite_ScannerTestSuite_test_tokenize_parallel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_tokenize_parallel() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 992, "test_tokenize_parallel" ) {}
+ void runTest() { suite_ScannerTestSuite.test_tokenize_parallel(); }
+} testDescription_suite_ScannerTestSuite_test_tokenize_parallel;
+
+static class TestDescription_suite_ScannerTestSuite_test_next_and_peek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_next_and_peek() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1011, "test_next_and_peek" ) {}
+ void runTest() { suite_ScannerTestSuite.test_next_and_peek(); }
+} testDescription_suite_ScannerTestSuite_test_next_and_peek;
+
+static class TestDescription_suite_ScannerTestSuite_test_input_buffer_mapped : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_input_buffer_mapped() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1033, "test_input_buffer_mapped" ) {}
+ void runTest() { suite_ScannerTestSuite.test_input_buffer_mapped(); }
+} testDescription_suite_ScannerTestSuite_test_input_buffer_mapped;
+
+static class TestDescription_suite_ScannerTestSuite_test_input_buffer_pipe : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_input_buffer_pipe() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1060, "test_input_buffer_pipe" ) {}
+ void runTest() { suite_ScannerTestSuite.test_input_buffer_pipe(); }
+} testDescription_suite_ScannerTestSuite_test_input_buffer_pipe;
+
+static class TestDescription_suite_ScannerTestSuite_test_read_input_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_read_input_stream() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1079, "test_read_input_stream" ) {}
+ void runTest() { suite_ScannerTestSuite.test_read_input_stream(); }
+} testDescription_suite_ScannerTestSuite_test_read_input_stream;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1125, "test_scan_bad_syntax_good_tokens" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_bad_syntax_good_tokens(); }
+} testDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 1157, "test_scan_sample_forestLoss" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_sample_forestLoss(); }
+} testDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Name            : arena.cc
+ * Project         : fcal
+ * Module          : util
+ * Description     : This file implements the block handling of the
+ *                   bump-pointer arena.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/arena.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void Arena::Reset(void) {
+  for (Cleanup *c = cleanups_; c != NULL; c = c->next) {
+    c->destroy(c->object);
+  }
+  cleanups_ = NULL;
+  for (size_t i = 0; i < large_.size(); i++) {
+    delete[] large_[i];
+  }
+  large_.clear();
+  next_block_ = 0;
+  ptr_ = NULL;
+  end_ = NULL;
+  bytes_ = 0;
+} /* Arena::Reset() */
+
+void Arena::Release(void) {
+  Reset();
+  for (size_t i = 0; i < blocks_.size(); i++) {
+    delete[] blocks_[i];
+  }
+  blocks_.clear();
+} /* Arena::Release() */
+
+/*
+ * Called when the current block has no room for [size] bytes. Anything
+ * bigger than a quarter of a block gets a block of its own, so that the
+ * rest of the current block is not wasted on it.
+ */
+void *Arena::AllocateSlow(size_t size, size_t align) {
+  size_t needed = size + align - 1;
+  if (needed > kArenaBlockSize / 4) {
+    char *block = new char[needed];
+    large_.push_back(block);
+    uintptr_t at = (reinterpret_cast<uintptr_t>(block) + align - 1) &
+        ~static_cast<uintptr_t>(align - 1);
+    bytes_ += size;
+    return reinterpret_cast<void *>(at);
+  }
+
+  if (next_block_ == blocks_.size()) {
+    blocks_.push_back(new char[kArenaBlockSize]);
+  }
+  char *block = blocks_[next_block_++];
+  ptr_ = block;
+  end_ = block + kArenaBlockSize;
+  return Allocate(size, align);
+} /* Arena::AllocateSlow() */
+
+} /* namespace fcal */
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Name            : batch.cc
+ * Project         : fcal
+ * Module          : parser
+ * Description     : This file parses and translates many programs at once.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <assert.h>
+#include <memory>
+#include "../include/batch.h"
+#include "../include/dead_code.h"
+#include "../include/parser.h"
+#include "../include/simplifier.h"
+#include "../include/type_checker.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace parser {
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * Runs [work](parser, i) for every i below [n] on [pool], one task per
+ * program so that the pool can steal them one at a time; [parser] is the
+ * Parser of the worker that runs it. Each task writes only to its own slot
+ * of the output, so no locking is needed.
+ */
+template <typename Work>
+static void for_each_program(size_t n, ThreadPool *pool, const Work &work) {
+  assert(pool->worker_index() < 0);
+  std::vector<std::unique_ptr<Parser> > parsers;
+  for (int i = 0; i < pool->size(); i++) {
+    parsers.push_back(std::unique_ptr<Parser>(new Parser()));
+  }
+  for (size_t i = 0; i < n; i++) {
+    pool->Submit([&parsers, &work, pool, i]() {
+      work(parsers[pool->worker_index()].get(), i);
+    });
+  }
+  pool->Wait();
+} /* for_each_program() */
+
+std::vector<ParseResult> ParseMany(const std::vector<const char *> &texts,
+                                   ThreadPool *pool) {
+  std::vector<ParseResult> results(texts.size());
+  for_each_program(texts.size(), pool, [&](Parser *parser, size_t i) {
+    results[i] = parser->Parse(texts[i]);
+  });
+  return results;
+} /* ParseMany() */
+
+std::vector<Translation> TranslateMany(const std::vector<const char *> &texts,
+                                       ThreadPool *pool) {
+  std::vector<Translation> results(texts.size());
+  for_each_program(texts.size(), pool, [&](Parser *parser, size_t i) {
+    ParseResult pr = parser->Parse(texts[i]);
+    results[i].ok = pr.ok();
+    if (!pr.ok()) {
+      results[i].errors = pr.errors();
+      return;
+    }
+    ast::TypeChecker checker;
+    checker.Check(pr.ast());
+    if (!checker.errors().empty()) {
+      results[i].ok = false;
+      results[i].errors = checker.errors()[0];
+      for (size_t e = 1; e < checker.errors().size(); e++) {
+        results[i].errors += "\n" + checker.errors()[e];
+      }
+      return;
+    }
+    ast::Simplifier(pr.arena().get()).Simplify(pr.ast());
+    ast::DeadCodeEliminator(pr.arena().get()).Eliminate(pr.ast());
+    results[i].cpp = pr.ast()->CppCode();
+  });
+  return results;
+} /* TranslateMany() */
+
+} /* namespace parser */
+} /* namespace fcal */
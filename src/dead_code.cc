@@ -0,0 +1,436 @@
+/*******************************************************************************
+ * Name            : dead_code.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file implements the pass that removes the
+ *                   statements of an AST that cannot run or whose work is
+ *                   never used.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+#include "../include/dead_code.h"
+#include "../include/scopes.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* No variable or definition */
+static const size_t kNone = static_cast<size_t>(-1);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*
+ * Finds the statements that only set variables nothing reads. Each
+ * declaration makes a variable; a definition is a statement that sets one,
+ * by declaring it or by assigning to it or to one of its elements.
+ *
+ * A variable is live if a statement that stays reads it: one that is not a
+ * definition, or a definition of a live variable or of one that cannot go.
+ * A read made inside a definition is charged to the outermost one. The
+ * live variables are marked from those read outside definitions, with a
+ * worklist over the reads of their definitions; the variables left
+ * unmarked go with all their definitions, even when they read one another.
+ */
+class Liveness : public Walker<Liveness> {
+ public:
+  Liveness(void)
+      : bindings_(kNone), vars_(), defs_(), reads_(), open_(), work_() {}
+
+  /*
+   * Adds the dead statements of the tree under [root] to [dead], and
+   * returns whether there were any.
+   */
+  bool Find(Node *root, std::unordered_set<Stmt *> *dead);
+
+  bool Enter(Node *node);
+  Node *VisitVarExpr(VarExpr *node) { return Read(node, node->name()); }
+  Node *VisitMatrixRefExpr(MatrixRefExpr *node) {
+    return Read(node, node->name());
+  }
+  Node *VisitLetExpr(LetExpr *node) { return Close(node); }
+  Node *VisitIntDecl(IntDecl *node) { return Declare(node, node->name()); }
+  Node *VisitFloatDecl(FloatDecl *node) {
+    return Declare(node, node->name());
+  }
+  Node *VisitStringDecl(StringDecl *node) {
+    return Declare(node, node->name());
+  }
+  Node *VisitBooleanDecl(BooleanDecl *node) {
+    return Declare(node, node->name());
+  }
+  Node *VisitShortMatrixDecl(ShortMatrixDecl *node) {
+    return Declare(node, node->name());
+  }
+  Node *VisitLongMatrixDecl(LongMatrixDecl *node) {
+    bindings_.Close();
+    return Declare(node, node->name());
+  }
+  Node *VisitBlockStmt(BlockStmt *node) { return Close(node); }
+  Node *VisitStmt(Stmt *node);
+  Node *VisitRepeatStmt(RepeatStmt *node) { return Read(node, node->name()); }
+
+ private:
+  struct Variable {
+    bool live;
+    bool removable;
+  };
+  struct Definition {
+    Stmt *stmt;
+    size_t var;
+    /* Its reads, in reads_ */
+    size_t first_read, end_read;
+    /* Whether a let in it runs a statement, and so it must stay */
+    bool pinned;
+  };
+
+  size_t NewVariable(bool removable);
+  void Define(Stmt *stmt, size_t var);
+  void Pin(void);
+  Node *Read(Node *node, Symbol name);
+  Node *Declare(Node *node, Symbol name);
+  Node *Close(Node *node) {
+    bindings_.Close();
+    return node;
+  }
+  void Mark(size_t var);
+
+  /* The variable each name in scope is bound to */
+  Scopes<size_t> bindings_;
+  std::vector<Variable> vars_;
+  std::vector<Definition> defs_;
+  /* The variables read inside each definition, grouped by definition */
+  std::vector<size_t> reads_;
+  /* The definitions being walked, innermost last */
+  std::vector<size_t> open_;
+  /* The variables found live whose definitions are still to be marked */
+  std::vector<size_t> work_;
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/* Reads [expr] into [value] if it is True or False, in parentheses or not. */
+static bool constant(Expr *expr, bool *value) {
+  while (expr->kind() == kGroupExpr) {
+    expr = static_cast<GroupExpr *>(expr)->expr();
+  }
+  *value = (expr->kind() == kTrueExpr);
+  return expr->kind() == kTrueExpr || expr->kind() == kFalseExpr;
+} /* constant() */
+
+/*
+ * Whether [stmt] ends in an if statement without an else, which would take
+ * an else that follows it in the text.
+ */
+static bool is_open(Stmt *stmt) {
+  while (true) {
+    switch (stmt->kind()) {
+      case kIfStmt:
+        return true;
+      case kIfElseStmt:
+        stmt = static_cast<IfElseStmt *>(stmt)->else_stmt();
+        break;
+      case kWhileStmt:
+        stmt = static_cast<WhileStmt *>(stmt)->stmt();
+        break;
+      case kRepeatStmt:
+        stmt = static_cast<RepeatStmt *>(stmt)->stmt();
+        break;
+      default:
+        return false;
+    }
+  }
+} /* is_open() */
+
+/*
+ * Whether evaluating [expr] can do more than make a value: the statements
+ * of a let expression in it may print, loop or set variables.
+ */
+static bool has_effects(Expr *expr) {
+  std::vector<Node *> stack(1, expr);
+  Node *children[kMaxChildren];
+  while (!stack.empty()) {
+    Node *node = stack.back();
+    stack.pop_back();
+    if (node->kind() == kLetExpr) {
+      return true;
+    }
+    for (size_t i = Children(node, children); i > 0; i--) {
+      if (children[i - 1] != NULL) {
+        stack.push_back(children[i - 1]);
+      }
+    }
+  }
+  return false;
+} /* has_effects() */
+
+static bool is_empty(Stmt *stmt) {
+  return stmt->kind() == kBlockStmt &&
+         static_cast<BlockStmt *>(stmt)->stmts()->size() == 0;
+} /* is_empty() */
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool Liveness::Find(Node *root, std::unordered_set<Stmt *> *dead) {
+  Walk(root);
+  // The definitions of each variable, grouped by variable.
+  std::vector<size_t> first_def(vars_.size() + 1, 0);
+  for (size_t d = 0; d < defs_.size(); d++) {
+    if (defs_[d].var != kNone) {
+      first_def[defs_[d].var + 1]++;
+      if (defs_[d].pinned) {
+        vars_[defs_[d].var].removable = false;
+      }
+    }
+  }
+  for (size_t v = 0; v < vars_.size(); v++) {
+    first_def[v + 1] += first_def[v];
+  }
+  std::vector<size_t> var_defs(first_def.back());
+  std::vector<size_t> next(first_def.begin(), first_def.end() - 1);
+  for (size_t d = 0; d < defs_.size(); d++) {
+    if (defs_[d].var != kNone) {
+      var_defs[next[defs_[d].var]++] = d;
+    }
+  }
+
+  for (size_t v = 0; v < vars_.size(); v++) {
+    if (!vars_[v].removable) {
+      Mark(v);
+    }
+  }
+  for (size_t d = 0; d < defs_.size(); d++) {
+    if (defs_[d].var == kNone) {
+      for (size_t r = defs_[d].first_read; r < defs_[d].end_read; r++) {
+        Mark(reads_[r]);
+      }
+    }
+  }
+  while (!work_.empty()) {
+    size_t var = work_.back();
+    work_.pop_back();
+    for (size_t i = first_def[var]; i < first_def[var + 1]; i++) {
+      const Definition &def = defs_[var_defs[i]];
+      for (size_t r = def.first_read; r < def.end_read; r++) {
+        Mark(reads_[r]);
+      }
+    }
+  }
+
+  bool found = false;
+  for (size_t v = 0; v < vars_.size(); v++) {
+    if (!vars_[v].live) {
+      for (size_t i = first_def[v]; i < first_def[v + 1]; i++) {
+        dead->insert(defs_[var_defs[i]].stmt);
+      }
+      found = true;
+    }
+  }
+  return found;
+} /* Liveness::Find() */
+
+/*
+ * Scopes open here, as the type checker opens them, and so do
+ * definitions: the variable an assignment sets is known before its value
+ * is walked, while a declaration's is only made once its value has been.
+ * Any other statement met inside a definition is in a let expression.
+ */
+bool Liveness::Enter(Node *node) {
+  if (node->kind() > kDeclStmt && node->kind() <= kEmptyStmt) {
+    Pin();
+  }
+  switch (node->kind()) {
+    case kBlockStmt:
+    case kLetExpr:
+      bindings_.Open();
+      break;
+    case kLongMatrixDecl: {
+      LongMatrixDecl *decl = static_cast<LongMatrixDecl *>(node);
+      bindings_.Open();
+      bindings_.Bind(decl->name_left(), NewVariable(false));
+      bindings_.Bind(decl->name_right(), NewVariable(false));
+      break;
+    }
+    case kDeclStmt:
+      Define(static_cast<Stmt *>(node), kNone);
+      break;
+    case kAssignStmt:
+      Define(static_cast<Stmt *>(node),
+             bindings_.Lookup(static_cast<AssignStmt *>(node)->name()));
+      break;
+    case kMatrixAssignStmt:
+      Define(static_cast<Stmt *>(node),
+             bindings_.Lookup(static_cast<MatrixAssignStmt *>(node)->name()));
+      break;
+    default:
+      break;
+  }
+  return true;
+} /* Liveness::Enter() */
+
+/* Closes the definitions Enter() opened. */
+Node *Liveness::VisitStmt(Stmt *node) {
+  if (!open_.empty() && defs_[open_.back()].stmt == node) {
+    size_t def = open_.back();
+    open_.pop_back();
+    if (open_.empty()) {
+      defs_[def].end_read = reads_.size();
+    }
+  }
+  return node;
+} /* Liveness::VisitStmt() */
+
+size_t Liveness::NewVariable(bool removable) {
+  Variable var = {false, removable};
+  vars_.push_back(var);
+  return vars_.size() - 1;
+} /* Liveness::NewVariable() */
+
+void Liveness::Define(Stmt *stmt, size_t var) {
+  Definition def = {stmt, var, reads_.size(), reads_.size(), false};
+  if (!open_.empty()) {
+    def.first_read = def.end_read = 0;
+  }
+  defs_.push_back(def);
+  open_.push_back(defs_.size() - 1);
+} /* Liveness::Define() */
+
+/*
+ * Keeps the definitions being walked, as a statement in a let expression
+ * inside them may print, loop or set a variable.
+ */
+void Liveness::Pin(void) {
+  for (size_t i = 0; i < open_.size(); i++) {
+    defs_[open_[i]].pinned = true;
+  }
+} /* Liveness::Pin() */
+
+Node *Liveness::Read(Node *node, Symbol name) {
+  size_t var = bindings_.Lookup(name);
+  if (var == kNone) {
+    return node;
+  }
+  if (open_.empty()) {
+    Mark(var);
+  } else {
+    reads_.push_back(var);
+  }
+  return node;
+} /* Liveness::Read() */
+
+Node *Liveness::Declare(Node *node, Symbol name) {
+  if (!name.empty() && !open_.empty()) {
+    size_t var = NewVariable(true);
+    defs_[open_.back()].var = var;
+    bindings_.Bind(name, var);
+  }
+  return node;
+} /* Liveness::Declare() */
+
+void Liveness::Mark(size_t var) {
+  if (!vars_[var].live) {
+    vars_[var].live = true;
+    work_.push_back(var);
+  }
+} /* Liveness::Mark() */
+
+/*
+ * Removing dead statements can leave an if statement with nothing to run,
+ * whose condition may have been the last read of a variable; only then is
+ * liveness found again.
+ */
+Node *DeadCodeEliminator::Eliminate(Node *root) {
+  root = Walk(root);
+  while (Liveness().Find(root, &dead_)) {
+    dropped_ = false;
+    root = Walk(root);
+    dead_.clear();
+    if (!dropped_) {
+      break;
+    }
+  }
+  return root;
+} /* DeadCodeEliminator::Eliminate() */
+
+Node *DeadCodeEliminator::VisitStmts(Stmts *node) {
+  Stmt **kept = node->begin();
+  for (Stmt **stmt = node->begin(); stmt != node->end(); stmt++) {
+    if (!is_empty(*stmt)) {
+      *kept++ = *stmt;
+    }
+  }
+  node->set_stmts(node->begin(), kept - node->begin());
+  return node;
+} /* DeadCodeEliminator::VisitStmts() */
+
+/* A statement with nothing to run goes, unless its condition does more. */
+Node *DeadCodeEliminator::VisitIfStmt(IfStmt *node) {
+  bool test;
+  if (constant(node->expr(), &test)) {
+    return test ? Body(node->stmt()) : Empty();
+  }
+  if (is_empty(node->stmt()) && !has_effects(node->expr())) {
+    return Dropped();
+  }
+  return node;
+} /* DeadCodeEliminator::VisitIfStmt() */
+
+Node *DeadCodeEliminator::VisitIfElseStmt(IfElseStmt *node) {
+  bool test;
+  if (constant(node->expr(), &test)) {
+    return Body(test ? node->then_stmt() : node->else_stmt());
+  }
+  if (is_empty(node->else_stmt())) {
+    return VisitIfStmt(arena_->New<IfStmt>(node->expr(), node->then_stmt()));
+  }
+  // A branch pruned inside the first one may have left it open.
+  if (is_open(node->then_stmt())) {
+    node->set_then_stmt(Block(node->then_stmt()));
+  }
+  return node;
+} /* DeadCodeEliminator::VisitIfElseStmt() */
+
+Node *DeadCodeEliminator::VisitWhileStmt(WhileStmt *node) {
+  bool test;
+  if (constant(node->expr(), &test) && !test) {
+    return Empty();
+  }
+  return node;
+} /* DeadCodeEliminator::VisitWhileStmt() */
+
+/*
+ * The C++ for a branch is a block of its own, so a declaration that is a
+ * whole branch is seen by nothing.
+ */
+Stmt *DeadCodeEliminator::Body(Stmt *node) {
+  return (node->kind() == kDeclStmt) ? Empty() : node;
+} /* DeadCodeEliminator::Body() */
+
+Stmt *DeadCodeEliminator::Block(Stmt *node) {
+  Stmt **stmts = static_cast<Stmt **>(
+      arena_->Allocate(sizeof(*stmts), alignof(Stmt *)));
+  stmts[0] = node;
+  return arena_->New<BlockStmt>(arena_->New<Stmts>(stmts, 1));
+} /* DeadCodeEliminator::Block() */
+
+Stmt *DeadCodeEliminator::Empty(void) {
+  return arena_->New<BlockStmt>(
+      arena_->New<Stmts>(static_cast<Stmt **>(NULL), 0));
+} /* DeadCodeEliminator::Empty() */
+
+} /* namespace ast */
+} /* namespace fcal */
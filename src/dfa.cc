@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Name            : dfa.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : This file builds a minimized DFA from a Thompson NFA.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <map>
+#include <vector>
+#include "../include/dfa.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const int kMaxDfaStates = 32767;
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool Dfa::Build(const Nfa &nfa) {
+  /*
+   * Group bytes into classes: two bytes share a class when every NFA
+   * transition accepts both or neither of them.
+   */
+  std::vector<int> representative;
+  num_classes_ = nfa.ByteClasses(classes_, &representative);
+
+  /*
+   * Subset construction. DFA state 0 is the empty set (the dead state) and
+   * state 1 is the closure of the NFA start state.
+   */
+  std::vector<std::vector<int> > sets;
+  std::map<std::vector<int>, int> index;
+  sets.push_back(std::vector<int>());
+  index[sets[0]] = kDfaDeadState;
+
+  std::vector<int> start(1, nfa.start());
+  nfa.Closure(&start);
+  std::sort(start.begin(), start.end());
+  sets.push_back(start);
+  index[start] = kDfaStartState;
+
+  std::vector<int> next;
+  for (size_t d = 0; d < sets.size(); d++) {
+    for (int k = 0; k < num_classes_; k++) {
+      std::vector<int> moved;
+      for (size_t i = 0; i < sets[d].size(); i++) {
+        const NfaState &s = nfa.state(sets[d][i]);
+        if (s.kind == NfaState::kCharState &&
+            s.chars.test(representative[k])) {
+          moved.push_back(s.out);
+        }
+      }
+      nfa.Closure(&moved);
+      std::sort(moved.begin(), moved.end());
+      moved.erase(std::unique(moved.begin(), moved.end()), moved.end());
+
+      std::map<std::vector<int>, int>::iterator it = index.find(moved);
+      if (it == index.end()) {
+        if (sets.size() > static_cast<size_t>(kMaxDfaStates)) {
+          return false;
+        }
+        it = index.insert(std::make_pair(moved,
+                          static_cast<int>(sets.size()))).first;
+        sets.push_back(moved);
+      }
+      next.push_back(it->second);
+    }
+  } /* for() */
+
+  next_.assign(next.begin(), next.end());
+  accept_.assign(sets.size(), kNfaNoTag);
+  for (size_t d = 0; d < sets.size(); d++) {
+    for (size_t i = 0; i < sets[d].size(); i++) {
+      const NfaState &s = nfa.state(sets[d][i]);
+      if (s.kind == NfaState::kMatchState &&
+          (accept_[d] == kNfaNoTag || s.tag < accept_[d])) {
+        accept_[d] = static_cast<int16_t>(s.tag);
+      }
+    }
+  }
+
+  Minimize();
+  return true;
+} /* Dfa::Build() */
+
+/*
+ * Minimize() - Merge equivalent states by partition refinement. States start
+ * out grouped by their accepting tag, and groups are split until every state
+ * in a group moves to the same groups on every byte class.
+ */
+void Dfa::Minimize(void) {
+  int n = num_states();
+  std::vector<int> block(n);
+  int num_blocks = 0;
+  {
+    std::map<int, int> by_tag;
+    for (int s = 0; s < n; s++) {
+      std::map<int, int>::iterator it = by_tag.find(accept_[s]);
+      if (it == by_tag.end()) {
+        it = by_tag.insert(std::make_pair(accept_[s], num_blocks++)).first;
+      }
+      block[s] = it->second;
+    }
+  }
+
+  for (;;) {
+    std::map<std::vector<int>, int> by_signature;
+    std::vector<int> refined(n);
+    for (int s = 0; s < n; s++) {
+      std::vector<int> sig(1, block[s]);
+      for (int k = 0; k < num_classes_; k++) {
+        sig.push_back(block[next_[s * num_classes_ + k]]);
+      }
+      std::map<std::vector<int>, int>::iterator it = by_signature.find(sig);
+      if (it == by_signature.end()) {
+        int id = static_cast<int>(by_signature.size());
+        it = by_signature.insert(std::make_pair(sig, id)).first;
+      }
+      refined[s] = it->second;
+    }
+    int refined_blocks = static_cast<int>(by_signature.size());
+    block.swap(refined);
+    if (refined_blocks == num_blocks) {
+      break;
+    }
+    num_blocks = refined_blocks;
+  } /* for() */
+
+  // Renumber the blocks so the dead and start states keep their indices.
+  std::vector<int> renumber(num_blocks, -1);
+  int next_id = 0;
+  renumber[block[kDfaDeadState]] = next_id++;
+  // A start state that accepts nothing still needs a row of its own.
+  bool empty_language = (block[kDfaStartState] == block[kDfaDeadState]);
+  if (empty_language) {
+    next_id++;
+  } else {
+    renumber[block[kDfaStartState]] = next_id++;
+  }
+  for (int s = 0; s < n; s++) {
+    if (renumber[block[s]] == -1) {
+      renumber[block[s]] = next_id++;
+    }
+  }
+
+  std::vector<int16_t> next(next_id * num_classes_, kDfaDeadState);
+  std::vector<int16_t> accept(next_id, kNfaNoTag);
+  for (int s = 0; s < n; s++) {
+    int b = renumber[block[s]];
+    if (empty_language && s == kDfaStartState) {
+      continue;
+    }
+    accept[b] = accept_[s];
+    for (int k = 0; k < num_classes_; k++) {
+      next[b * num_classes_ + k] = static_cast<int16_t>(
+          renumber[block[next_[s * num_classes_ + k]]]);
+    }
+  }
+  next_.swap(next);
+  accept_.swap(accept);
+} /* Dfa::Minimize() */
+
+} /* namespace scanner */
+} /* namespace fcal */
@@ -0,0 +1,375 @@
+/*******************************************************************************
+ * Name            : emitter.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file implements the emitter that writes an AST out
+ *                   as text, and the visitors that list each node's text.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/emitter.h"
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+#include "../include/ast.h"
+#include "../include/visitor.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/*!
+ * FcalWriter
+ * Gives the emitter the parts of a node's source text, as UnParse() writes
+ * it: its text and its children in order.
+ */
+class FcalWriter : public Visitor<FcalWriter> {
+ public:
+  explicit FcalWriter(Emitter *out) : out_(out) {}
+
+  void VisitVarExpr(VarExpr *node) { *out_ << node->name(); }
+  void VisitIntConstExpr(IntConstExpr *node) { *out_ << node->value(); }
+  void VisitFloatConstExpr(FloatConstExpr *node) { *out_ << node->value(); }
+  void VisitStringConstExpr(StringConstExpr *node) {
+    *out_ << node->value();
+  }
+  void VisitTrueExpr(TrueExpr *) { *out_ << "True"; }
+  void VisitFalseExpr(FalseExpr *) { *out_ << "False"; }
+  void VisitMulExpr(MulExpr *node) { Infix(node, " * "); }
+  void VisitDivExpr(DivExpr *node) { Infix(node, " / "); }
+  void VisitPlusExpr(PlusExpr *node) { Infix(node, " + "); }
+  void VisitMinusExpr(MinusExpr *node) { Infix(node, " - "); }
+  void VisitGreaterExpr(GreaterExpr *node) { Infix(node, " > "); }
+  void VisitGreaterEqualExpr(GreaterEqualExpr *node) { Infix(node, " >= "); }
+  void VisitLessExpr(LessExpr *node) { Infix(node, " < "); }
+  void VisitLessEqualExpr(LessEqualExpr *node) { Infix(node, " <= "); }
+  void VisitEqualEqualExpr(EqualEqualExpr *node) { Infix(node, " == "); }
+  void VisitNotEqualExpr(NotEqualExpr *node) { Infix(node, " != "); }
+  void VisitAndExpr(AndExpr *node) { Infix(node, " && "); }
+  void VisitOrExpr(OrExpr *node) { Infix(node, " || "); }
+  void VisitMatrixRefExpr(MatrixRefExpr *node) {
+    *out_ << node->name() << " [" << node->expr_left() << ": "
+          << node->expr_right() << "]";
+  }
+  void VisitFuncCallExpr(FuncCallExpr *node) {
+    *out_ << node->name() << "(" << node->expr() << ")";
+  }
+  void VisitGroupExpr(GroupExpr *node) {
+    *out_ << "(" << node->expr() << ")";
+  }
+  void VisitIfExpr(IfExpr *node) {
+    *out_ << "if " << node->expr_test() << " then " << node->expr_then()
+          << " else " << node->expr_else();
+  }
+  void VisitNotExpr(NotExpr *node) { *out_ << "!" << node->expr(); }
+  void VisitLetExpr(LetExpr *node) {
+    *out_ << "let " << node->stmts() << "in " << node->expr() << " end";
+  }
+  void VisitIntDecl(IntDecl *node) {
+    *out_ << "int " << node->name() << ";\n";
+  }
+  void VisitFloatDecl(FloatDecl *node) {
+    *out_ << "float " << node->name() << ";\n";
+  }
+  void VisitStringDecl(StringDecl *node) {
+    *out_ << "string " << node->name() << ";\n";
+  }
+  void VisitBooleanDecl(BooleanDecl *node) {
+    *out_ << "boolean " << node->name() << ";\n";
+  }
+  void VisitShortMatrixDecl(ShortMatrixDecl *node) {
+    *out_ << "matrix " << node->name() << " = " << node->expr() << ";\n";
+  }
+  void VisitLongMatrixDecl(LongMatrixDecl *node) {
+    *out_ << "matrix " << node->name() << " [ " << node->expr_left() << " : "
+          << node->expr_right() << " ] " << node->name_left() << " : "
+          << node->name_right() << " = " << node->expr() << ";\n";
+  }
+  void VisitStmts(Stmts *node) {
+    for (Stmt *stmt : *node) {
+      *out_ << stmt;
+    }
+  }
+  void VisitDeclStmt(DeclStmt *node) { *out_ << node->decl(); }
+  void VisitBlockStmt(BlockStmt *node) {
+    *out_ << " {" << node->stmts() << "} ";
+  }
+  void VisitIfStmt(IfStmt *node) {
+    *out_ << "if (" << node->expr() << ") " << node->stmt();
+  }
+  void VisitIfElseStmt(IfElseStmt *node) {
+    *out_ << "if (" << node->expr() << ") " << node->then_stmt() << " else "
+          << node->else_stmt();
+  }
+  void VisitAssignStmt(AssignStmt *node) {
+    *out_ << node->name() << " = " << node->expr() << ";\n";
+  }
+  void VisitMatrixAssignStmt(MatrixAssignStmt *node) {
+    *out_ << node->name() << " [" << node->expr_left() << " : "
+          << node->expr_right() << "] = " << node->expr_result() << ";\n";
+  }
+  void VisitPrintStmt(PrintStmt *node) {
+    *out_ << "print (" << node->expr() << ");";
+  }
+  void VisitRepeatStmt(RepeatStmt *node) {
+    *out_ << "repeat (" << node->name() << " = " << node->expr_lower()
+          << " to " << node->expr_upper() << ")" << node->stmt();
+  }
+  void VisitWhileStmt(WhileStmt *node) {
+    *out_ << "while (" << node->expr() << ") " << node->stmt();
+  }
+  void VisitEmptyStmt(EmptyStmt *) { *out_ << ";\n"; }
+  void VisitProgram(Program *node) {
+    *out_ << node->name() << "() {\n" << node->stmts() << "}";
+  }
+
+ private:
+  template <typename N>
+  void Infix(N *node, const char *op) {
+    *out_ << node->expr_left() << op << node->expr_right();
+  }
+
+  Emitter *out_;
+};
+
+/*!
+ * CppWriter
+ * Gives the emitter the parts of a node's translation to C++, as CppCode()
+ * writes it. Where the TypeChecker has typed an expression the translation
+ * is specialized on its type: float constants stay in single precision and
+ * matrices are multiplied by matrix::multiply() rather than an operator.
+ */
+class CppWriter : public Visitor<CppWriter> {
+ public:
+  explicit CppWriter(Emitter *out) : out_(out) {}
+
+  void VisitVarExpr(VarExpr *node) { *out_ << node->name(); }
+  void VisitIntConstExpr(IntConstExpr *node) { *out_ << node->value(); }
+  void VisitFloatConstExpr(FloatConstExpr *node) {
+    *out_ << node->value() << "f";
+  }
+  void VisitStringConstExpr(StringConstExpr *node) {
+    *out_ << node->value();
+  }
+  void VisitTrueExpr(TrueExpr *) { *out_ << "true"; }
+  void VisitFalseExpr(FalseExpr *) { *out_ << "false"; }
+  void VisitMulExpr(MulExpr *node) {
+    if (node->type() == kMatrixType) {
+      Infix(node, "matrix::multiply(", ", ", ")");
+    } else {
+      Infix(node, "(", " * ", ")");
+    }
+  }
+  void VisitDivExpr(DivExpr *node) { Infix(node, "(", " / ", ")"); }
+  void VisitPlusExpr(PlusExpr *node) { Infix(node, "(", " + ", ")"); }
+  void VisitMinusExpr(MinusExpr *node) { Infix(node, "(", " - ", ")"); }
+  void VisitGreaterExpr(GreaterExpr *node) { Infix(node, "(", " > ", ")"); }
+  void VisitGreaterEqualExpr(GreaterEqualExpr *node) {
+    Infix(node, "(", " >= ", ")");
+  }
+  void VisitLessExpr(LessExpr *node) { Infix(node, "( ", " < ", " )"); }
+  void VisitLessEqualExpr(LessEqualExpr *node) {
+    Infix(node, "(", " <= ", ")");
+  }
+  void VisitEqualEqualExpr(EqualEqualExpr *node) {
+    Infix(node, "", " == ", "");
+  }
+  void VisitNotEqualExpr(NotEqualExpr *node) { Infix(node, "", " != ", ""); }
+  void VisitAndExpr(AndExpr *node) { Infix(node, "", " && ", ""); }
+  void VisitOrExpr(OrExpr *node) { Infix(node, "", " || ", ""); }
+  void VisitMatrixRefExpr(MatrixRefExpr *node) {
+    *out_ << "*(" << node->name() << ".access(" << node->expr_left() << ", "
+          << node->expr_right() << "))";
+  }
+  void VisitFuncCallExpr(FuncCallExpr *node) {
+    int id = node->name().id();
+    if (id == kNRowsSymbol || id == kNColsSymbol) {
+      *out_ << node->expr() << "." << node->name() << "()";
+    } else if (id == kMatrixReadSymbol) {
+      *out_ << "matrix::" << node->name() << "(" << node->expr() << ")";
+    } else {
+      *out_ << node->name() << "(" << node->expr() << ")";
+    }
+  }
+  void VisitGroupExpr(GroupExpr *node) {
+    *out_ << "(" << node->expr() << ")";
+  }
+  void VisitIfExpr(IfExpr *node) {
+    *out_ << "( " << node->expr_test() << " ? " << node->expr_then() << " : "
+          << node->expr_else() << ")\n";
+  }
+  void VisitNotExpr(NotExpr *node) { *out_ << "!(" << node->expr() << ")"; }
+  void VisitLetExpr(LetExpr *node) {
+    *out_ << "({ " << node->stmts() << "\n  " << node->expr() << "; })";
+  }
+  void VisitIntDecl(IntDecl *node) {
+    *out_ << "int " << node->name() << ";\n";
+  }
+  void VisitFloatDecl(FloatDecl *node) {
+    *out_ << "float " << node->name() << ";\n";
+  }
+  void VisitStringDecl(StringDecl *node) {
+    *out_ << "string " << node->name() << ";\n";
+  }
+  void VisitBooleanDecl(BooleanDecl *node) {
+    *out_ << "bool " << node->name() << ";\n";
+  }
+  void VisitShortMatrixDecl(ShortMatrixDecl *node) {
+    *out_ << "matrix " << node->name() << " = " << node->expr() << ";\n";
+  }
+  void VisitLongMatrixDecl(LongMatrixDecl *node) {
+    Symbol row = node->name_left();
+    Symbol col = node->name_right();
+    *out_ << "matrix " << node->name() << "( " << node->expr_left() << ", "
+          << node->expr_right() << " );\n"
+          << "for (int " << row << " = 0; " << row << " < "
+          << node->expr_left() << "; " << row << " ++) {\n"
+          << "  for (int " << col << " = 0; " << col << " < "
+          << node->expr_right() << "; " << col << " ++ ) {\n"
+          << "     *(" << node->name() << ".access(" << row << ", " << col
+          << ")) = " << node->expr() << ";\n  }\n}\n";
+  }
+  void VisitStmts(Stmts *node) {
+    for (Stmt *stmt : *node) {
+      *out_ << stmt;
+    }
+  }
+  void VisitDeclStmt(DeclStmt *node) { *out_ << node->decl(); }
+  void VisitBlockStmt(BlockStmt *node) {
+    *out_ << " {" << node->stmts() << "} ";
+  }
+  void VisitIfStmt(IfStmt *node) {
+    *out_ << "if (" << node->expr() << ") {\n  " << node->stmt() << "}";
+  }
+  void VisitIfElseStmt(IfElseStmt *node) {
+    *out_ << "if (" << node->expr() << ") {\n  " << node->then_stmt()
+          << "} else {\n  " << node->else_stmt() << "}";
+  }
+  void VisitAssignStmt(AssignStmt *node) {
+    *out_ << node->name() << " = " << node->expr() << ";\n";
+  }
+  void VisitMatrixAssignStmt(MatrixAssignStmt *node) {
+    *out_ << "*( " << node->name() << ".access(" << node->expr_left() << ", "
+          << node->expr_right() << ")) = " << node->expr_result() << ";\n";
+  }
+  void VisitPrintStmt(PrintStmt *node) {
+    *out_ << "cout << " << node->expr() << " ;\n";
+  }
+  void VisitRepeatStmt(RepeatStmt *node) {
+    *out_ << "for (" << node->name() << " = " << node->expr_lower() << "; "
+          << node->name() << " <= " << node->expr_upper() << "; "
+          << node->name() << " ++ )  \n" << "  " << node->stmt() << "\n";
+  }
+  void VisitWhileStmt(WhileStmt *node) {
+    *out_ << "while (" << node->expr() << ") {\n" << node->stmt() << "}\n";
+  }
+  void VisitEmptyStmt(EmptyStmt *) { *out_ << ";\n"; }
+  void VisitProgram(Program *node) {
+    *out_ << "#include <iostream>\n#include \"../include/Matrix.h\"\n"
+          << "#include <math.h>\nusing namespace std;\nint " << node->name()
+          << "() {\n" << node->stmts() << "}";
+  }
+
+ private:
+  template <typename N>
+  void Infix(N *node, const char *open, const char *op, const char *close) {
+    *out_ << open << node->expr_left() << op << node->expr_right() << close;
+  }
+
+  Emitter *out_;
+};
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+/*
+ * Each node adds its parts to the end of parts_ in order, from its first
+ * child on; they are then reversed, so that the stack pops them in order,
+ * and a child is only expanded once the text before it has been written.
+ */
+void Emitter::Emit(Node *root, Language language) {
+  Language outer = language_;
+  language_ = language;
+  FcalWriter fcal(this);
+  CppWriter cpp(this);
+  size_t base = parts_.size();
+  *this << root;
+  while (parts_.size() > base) {
+    Part part = parts_.back();
+    parts_.pop_back();
+    if (part.node == NULL) {
+      Write(part.text, part.length);
+      continue;
+    }
+    first_ = parts_.size();
+    if (language_ == kCpp) {
+      cpp.Visit(part.node);
+    } else {
+      fcal.Visit(part.node);
+    }
+    std::reverse(parts_.begin() + first_, parts_.end());
+  }
+  first_ = parts_.size();
+  language_ = outer;
+} /* Emitter::Emit() */
+
+bool Emitter::Flush(void) {
+  WriteOut(buffer_.get(), used_);
+  used_ = 0;
+  return ok_;
+} /* Emitter::Flush() */
+
+/*
+ * The buffer is only made once there is something to write, and grows
+ * to fit what is written until it reaches kEmitBufferSize; text that would
+ * overflow a full buffer by itself skips it.
+ */
+void Emitter::WriteSlow(const char *text, size_t length) {
+  if (used_ + length <= kEmitBufferSize) {
+    size_t capacity = std::max(used_ + length, 2 * capacity_);
+    capacity = std::min(std::max(capacity, static_cast<size_t>(256)),
+                        kEmitBufferSize);
+    std::unique_ptr<char[]> buffer(new char[capacity]);
+    memcpy(buffer.get(), buffer_.get(), used_);
+    buffer_.swap(buffer);
+    capacity_ = capacity;
+  } else {
+    Flush();
+    if (length >= kEmitBufferSize) {
+      WriteOut(text, length);
+      return;
+    }
+    if (capacity_ < length) {
+      buffer_.reset(new char[kEmitBufferSize]);
+      capacity_ = kEmitBufferSize;
+    }
+  }
+  memcpy(buffer_.get() + used_, text, length);
+  used_ += length;
+} /* Emitter::WriteSlow() */
+
+/* Writes all of [text] to the file, unless a write fails. */
+void Emitter::WriteOut(const char *text, size_t length) {
+  while (length > 0 && ok_) {
+    ssize_t written = write(fd_, text, length);
+    if (written < 0) {
+      ok_ = (errno == EINTR);
+      continue;
+    }
+    text += written;
+    length -= written;
+  }
+} /* Emitter::WriteOut() */
+
+} /* namespace ast */
+} /* namespace fcal */
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Name            : lexgen.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : Build-time generator for the scanner's DFA tables. It
+ *                   compiles kTokenSpecs and kSkipPatterns into minimized DFAs
+ *                   and writes them to stdout as constexpr C++ arrays, which
+ *                   scanner.cc includes as lexer_tables.h.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdio.h>
+#include "../include/dfa.h"
+#include "../include/nfa.h"
+#include "../include/scanner.h"
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+namespace fs = fcal::scanner;
+
+static void write_array(const char *type, const char *name,
+                        const int16_t *values, int count) {
+  printf("constexpr %s %s[%d] = {", type, name, count);
+  for (int i = 0; i < count; i++) {
+    printf("%s%d,", (i % 16 == 0) ? "\n    " : " ", values[i]);
+  }
+  printf("\n};\n");
+}
+
+static void write_tables(const char *name, const fs::Dfa &dfa) {
+  fs::DfaTables t = dfa.tables();
+  int16_t classes[256];
+  for (int c = 0; c < 256; c++) {
+    classes[c] = t.classes[c];
+  }
+
+  printf("\n// %s: %d states, %d byte classes\n", name, dfa.num_states(),
+         t.num_classes);
+  char array_name[64];
+  snprintf(array_name, sizeof(array_name), "%sClasses", name);
+  write_array("uint8_t", array_name, classes, 256);
+  snprintf(array_name, sizeof(array_name), "%sNext", name);
+  write_array("int16_t", array_name, t.next, dfa.num_states() * t.num_classes);
+  snprintf(array_name, sizeof(array_name), "%sAccept", name);
+  write_array("int16_t", array_name, t.accept, dfa.num_states());
+  printf("constexpr DfaTables %s = {\n    %d, %sClasses, %sNext, %sAccept\n};\n",
+         name, t.num_classes, name, name, name);
+}
+
+int main(void) {
+  // Keywords are picked out of variable names by lookup_keyword().
+  fs::Nfa token_nfa;
+  for (int i = 0; i < fs::kNumTokenSpecs; i++) {
+    if (fs::is_keyword(fs::kTokenSpecs[i].terminal)) {
+      continue;
+    }
+    if (!token_nfa.AddPattern(fs::kTokenSpecs[i].pattern,
+                              fs::kTokenSpecs[i].terminal)) {
+      fprintf(stderr, "lexgen: bad pattern %s\n", fs::kTokenSpecs[i].pattern);
+      return 1;
+    }
+  }
+
+  fs::Nfa skip_nfa;
+  for (int i = 0; i < fs::kNumSkipPatterns; i++) {
+    if (!skip_nfa.AddPattern(fs::kSkipPatterns[i], i)) {
+      fprintf(stderr, "lexgen: bad pattern %s\n", fs::kSkipPatterns[i]);
+      return 1;
+    }
+  }
+
+  fs::Dfa token_dfa;
+  fs::Dfa skip_dfa;
+  if (!token_dfa.Build(token_nfa) || !skip_dfa.Build(skip_nfa)) {
+    fprintf(stderr, "lexgen: DFA too large\n");
+    return 1;
+  }
+
+  printf("/* Generated by lexgen from src/token_specs.cc. Do not edit. */\n");
+  printf("#ifndef LEXER_TABLES_H_\n#define LEXER_TABLES_H_\n\n");
+  printf("#include <stdint.h>\n#include \"./include/dfa.h\"\n\n");
+  printf("namespace fcal {\nnamespace scanner {\n");
+  write_tables("kTokenDfa", token_dfa);
+  write_tables("kSkipDfa", skip_dfa);
+  printf("\n} /* namespace scanner */\n} /* namespace fcal */\n\n");
+  printf("#endif /* LEXER_TABLES_H_ */\n");
+  return 0;
+} /* main() */
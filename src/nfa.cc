@@ -0,0 +1,311 @@
+/*******************************************************************************
+ * Name            : nfa.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : This file compiles the scanner's regular expressions into
+ *                   a Thompson NFA.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <ctype.h>
+#include <vector>
+#include "../include/nfa.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool Nfa::AddPattern(const char *pattern, int tag) {
+  const char *p = pattern;
+  // Matching is always anchored, so a leading '^' carries no information.
+  if (*p == '^') {
+    p++;
+  }
+
+  Fragment f;
+  if (!ParseAlternation(&p, &f) || *p != '\0') {
+    return false;
+  }
+  int match = AddState(NfaState::kMatchState);
+  states_[match].tag = tag;
+  Patch(f, match);
+
+  if (start_ == kNfaNoState) {
+    start_ = f.start;
+  } else {
+    int split = AddState(NfaState::kSplitState);
+    states_[split].out = start_;
+    states_[split].out1 = f.start;
+    start_ = split;
+  }
+  return true;
+} /* Nfa::AddPattern() */
+
+void Nfa::Closure(std::vector<int> *set) const {
+  std::vector<bool> seen(states_.size(), false);
+  std::vector<int> work(*set);
+  for (size_t i = 0; i < set->size(); i++) {
+    seen[(*set)[i]] = true;
+  }
+
+  while (!work.empty()) {
+    int s = work.back();
+    work.pop_back();
+    if (states_[s].kind != NfaState::kSplitState) {
+      continue;
+    }
+    int edges[2] = { states_[s].out, states_[s].out1 };
+    for (int e = 0; e < 2; e++) {
+      if (edges[e] != kNfaNoState && !seen[edges[e]]) {
+        seen[edges[e]] = true;
+        set->push_back(edges[e]);
+        work.push_back(edges[e]);
+      }
+    }
+  } /* while() */
+} /* Nfa::Closure() */
+
+int Nfa::ByteClasses(uint8_t classes[256],
+                     std::vector<int> *representative) const {
+  /*
+   * Start with every byte in one class and split the classes by each char
+   * state in turn. Classes are numbered in order of their smallest byte.
+   */
+  int num_classes = 1;
+  for (int c = 0; c < 256; c++) {
+    classes[c] = 0;
+  }
+  for (size_t i = 0; i < states_.size(); i++) {
+    if (states_[i].kind != NfaState::kCharState) {
+      continue;
+    }
+    int renumber[2][256];
+    for (int k = 0; k < num_classes; k++) {
+      renumber[0][k] = renumber[1][k] = -1;
+    }
+    int next = 0;
+    for (int c = 0; c < 256; c++) {
+      int *slot = &renumber[states_[i].chars.test(c)][classes[c]];
+      if (*slot < 0) {
+        *slot = next++;
+      }
+      classes[c] = static_cast<uint8_t>(*slot);
+    }
+    num_classes = next;
+  }
+
+  representative->assign(num_classes, -1);
+  for (int c = 0; c < 256; c++) {
+    if ((*representative)[classes[c]] < 0) {
+      (*representative)[classes[c]] = c;
+    }
+  }
+  return num_classes;
+} /* Nfa::ByteClasses() */
+
+int Nfa::AddState(NfaState::Kind kind) {
+  NfaState s;
+  s.kind = kind;
+  s.out = kNfaNoState;
+  s.out1 = kNfaNoState;
+  s.tag = kNfaNoTag;
+  states_.push_back(s);
+  return static_cast<int>(states_.size()) - 1;
+} /* Nfa::AddState() */
+
+void Nfa::Patch(const Fragment &f, int target) {
+  for (size_t i = 0; i < f.dangling.size(); i++) {
+    NfaState &s = states_[f.dangling[i] / 2];
+    if (f.dangling[i] % 2 == 0) {
+      s.out = target;
+    } else {
+      s.out1 = target;
+    }
+  }
+} /* Nfa::Patch() */
+
+Nfa::Fragment Nfa::CharFragment(const CharSet &set) {
+  Fragment f;
+  f.start = AddState(NfaState::kCharState);
+  states_[f.start].chars = set;
+  f.dangling.push_back(f.start * 2);
+  return f;
+} /* Nfa::CharFragment() */
+
+/*
+ * Alternation ::= Concatenation ( '|' Concatenation )*
+ */
+bool Nfa::ParseAlternation(const char **p, Fragment *f) {
+  if (!ParseConcatenation(p, f)) {
+    return false;
+  }
+  while (**p == '|') {
+    (*p)++;
+    Fragment right;
+    if (!ParseConcatenation(p, &right)) {
+      return false;
+    }
+    int split = AddState(NfaState::kSplitState);
+    states_[split].out = f->start;
+    states_[split].out1 = right.start;
+    f->start = split;
+    f->dangling.insert(f->dangling.end(), right.dangling.begin(),
+                       right.dangling.end());
+  }
+  return true;
+} /* Nfa::ParseAlternation() */
+
+/*
+ * Concatenation ::= Repetition*
+ */
+bool Nfa::ParseConcatenation(const char **p, Fragment *f) {
+  // An empty concatenation matches the empty string.
+  int empty = AddState(NfaState::kSplitState);
+  f->start = empty;
+  f->dangling.assign(1, empty * 2);
+
+  while (**p != '\0' && **p != '|' && **p != ')') {
+    Fragment next;
+    if (!ParseRepetition(p, &next)) {
+      return false;
+    }
+    Patch(*f, next.start);
+    f->dangling = next.dangling;
+  }
+  return true;
+} /* Nfa::ParseConcatenation() */
+
+/*
+ * Repetition ::= Atom ( '*' | '+' | '?' )*
+ */
+bool Nfa::ParseRepetition(const char **p, Fragment *f) {
+  if (!ParseAtom(p, f)) {
+    return false;
+  }
+  while (**p == '*' || **p == '+' || **p == '?') {
+    int split = AddState(NfaState::kSplitState);
+    states_[split].out = f->start;
+    switch (**p) {
+      case '*':
+        Patch(*f, split);
+        f->start = split;
+        f->dangling.assign(1, split * 2 + 1);
+        break;
+      case '+':
+        Patch(*f, split);
+        f->dangling.assign(1, split * 2 + 1);
+        break;
+      default:
+        f->start = split;
+        f->dangling.push_back(split * 2 + 1);
+        break;
+    } /* switch() */
+    (*p)++;
+  }
+  return true;
+} /* Nfa::ParseRepetition() */
+
+/*
+ * Atom ::= '(' Alternation ')' | '[' Bracket ']' | '.' | '\' char | char
+ */
+bool Nfa::ParseAtom(const char **p, Fragment *f) {
+  CharSet set;
+  char c = **p;
+
+  switch (c) {
+    case '(':
+      (*p)++;
+      if (!ParseAlternation(p, f) || **p != ')') {
+        return false;
+      }
+      (*p)++;
+      return true;
+    case '[':
+      (*p)++;
+      if (!ParseBracket(p, &set)) {
+        return false;
+      }
+      break;
+    case '.':
+      (*p)++;
+      set.set();
+      break;
+    case '\\':
+      (*p)++;
+      c = **p;
+      // Escaped letters and digits are GNU extensions (\w, \1, ...) that
+      // the scanner never uses; refuse them instead of misreading them.
+      if (c == '\0' || isalnum(static_cast<unsigned char>(c))) {
+        return false;
+      }
+      (*p)++;
+      set.set(static_cast<unsigned char>(c));
+      break;
+    case '*': case '+': case '?': case '{': case '^': case '$':
+      return false;
+    default:
+      (*p)++;
+      set.set(static_cast<unsigned char>(c));
+      break;
+  } /* switch() */
+
+  set.reset(0);
+  *f = CharFragment(set);
+  return true;
+} /* Nfa::ParseAtom() */
+
+/*
+ * Bracket ::= '^'? ']'? ( char | char '-' char )* ']'
+ * The opening '[' has already been consumed.
+ */
+bool Nfa::ParseBracket(const char **p, CharSet *set) {
+  bool negate = false;
+  if (**p == '^') {
+    negate = true;
+    (*p)++;
+  }
+
+  bool first = true;
+  while (**p != ']' || first) {
+    unsigned char lo = static_cast<unsigned char>(**p);
+    if (lo == '\0') {
+      return false;
+    }
+    // Character classes and collating elements are not supported.
+    if (lo == '[' && ((*p)[1] == ':' || (*p)[1] == '=' || (*p)[1] == '.')) {
+      return false;
+    }
+    (*p)++;
+    unsigned char hi = lo;
+    if (**p == '-' && (*p)[1] != ']' && (*p)[1] != '\0') {
+      hi = static_cast<unsigned char>((*p)[1]);
+      (*p) += 2;
+      if (hi < lo) {
+        return false;
+      }
+    }
+    for (int ch = lo; ch <= hi; ch++) {
+      set->set(ch);
+    }
+    first = false;
+  } /* while() */
+  (*p)++;
+
+  if (negate) {
+    set->flip();
+  }
+  return true;
+} /* Nfa::ParseBracket() */
+
+} /* namespace scanner */
+} /* namespace fcal */
@@ -14,6 +14,8 @@
 #include "../include/parser.h"
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
+#include <algorithm>
 #include <sstream>
 #include "../include/ext_token.h"
 #include "../include/scanner.h"
@@ -29,45 +31,122 @@ namespace parser {
  ******************************************************************************/
 Parser::~Parser() {
   if (scanner_) delete scanner_;
-
-  scanner::ExtToken *to_delete1;
-  curr_token_ = tokens_;
-  while (curr_token_) {
-    to_delete1 = curr_token_;
-    curr_token_ = curr_token_->next();
-    delete to_delete1;
-  } /* while() */
-
-  scanner::Token *curr_scanner_token = stokens_;
-  scanner::Token *to_delete2;
-  while (curr_scanner_token) {
-    to_delete2 = curr_scanner_token;
-    curr_scanner_token = curr_scanner_token->next();
-    delete to_delete2;
-  } /* while() */
 } /* Parser::~Parser() */
 
 ParseResult Parser::Parse(const char *text) {
   assert(text != NULL);
 
-  ParseResult pr;
-  try {
+  Reset();
+  if (arena_ == NULL) {
+    arena_ = std::make_shared<Arena>();
+  }
+  symbols_ = arena_->New<ast::SymbolTable>(arena_.get());
+  if (scanner_ == NULL) {
     scanner_ = new scanner::Scanner();
-    stokens_ = scanner_->Scan(text);
-    tokens_ = tokens_->ExtendTokenList(this, stokens_);
-
-    assert(tokens_ != NULL);
-    curr_token_ = tokens_;
-    pr = ParseProgram();
   }
-  catch (std::string errMsg) {
-      pr.ok(false);
-      pr.errors(errMsg);
-      pr.ast(NULL);
+  size_t length = strlen(text);
+  scanner_->Start(text, length);
+  curr_token_ = scanner_->Next();
+
+  ParseResult pr = finish(ParseProgram(), length);
+  if (outline_ != NULL) {
+    outline_->parsed_bytes = arena_->bytes_allocated();
   }
+  // A failed parse's partial tree stays in arena_ until the next Reset().
   return pr;
 } /* Parser::parse() */
 
+ParseResult Parser::Reparse(const ParseResult &previous, const char *text,
+                            const std::vector<TextEdit> &edits) {
+  assert(text != NULL);
+
+  ParseOutline *old = previous.outline();
+  std::shared_ptr<Arena> arena = previous.arena();
+  if (old == NULL || arena == NULL ||
+      arena->bytes_allocated() > kReparseGrowth * old->parsed_bytes) {
+    return Parse(text);
+  }
+
+  // Boil the edits down to one range, [lo, hi_old) of the old text, that
+  // became [lo, hi_new) of the new one; the text around it is unchanged.
+  size_t old_length = old->text_length;
+  size_t length = old_length;
+  size_t lo = old_length;
+  size_t suffix = old_length;
+  for (size_t i = 0; i < edits.size(); i++) {
+    const TextEdit &e = edits[i];
+    if (e.offset + e.removed > length) {
+      return Parse(text);
+    }
+    length = length - e.removed + e.inserted;
+    lo = std::min(lo, e.offset);
+    suffix = std::min(suffix, length - e.offset - e.inserted);
+  }
+  if (length != strlen(text) || old->header_reach > lo) {
+    return Parse(text);
+  }
+  size_t hi_old = std::max(lo, old_length - suffix);
+  size_t hi_new = hi_old + length - old_length;
+
+  // The statements before the first one whose parse looked as far as the
+  // edits are kept, along with any broken ones between them and their
+  // errors; parsing starts over right after them.
+  const StmtSpan *first = std::partition_point(
+      old->spans, old->spans + old->num_spans,
+      [lo](const StmtSpan &span) { return span.reach <= lo; });
+  size_t num_kept = first - old->spans;
+  size_t restart = (num_kept > 0) ? first[-1].end : old->body_begin;
+
+  arena_ = arena;
+  symbols_ = previous.symbols();
+  outline_ = old;
+  spans_.assign(const_cast<const StmtSpan *>(old->spans), first);
+  errors_.clear();
+  for (size_t i = 0; i < previous.error_list().size(); i++) {
+    if (previous.error_list()[i].offset < restart) {
+      errors_.push_back(previous.error_list()[i]);
+    }
+  }
+  panicking_ = false;
+  if (scanner_ == NULL) {
+    scanner_ = new scanner::Scanner();
+  }
+  scanner_->Start(text, length);
+  scanner_->Seek(restart);
+  prev_token_ = scanner::CompactToken();
+  curr_token_ = scanner_->Next();
+
+  parse_body(old->program, old, num_kept, hi_new, length,
+             (num_kept > 0) ? first[-1].reach : old->header_reach);
+  match(scanner::kRightCurly);
+  match(scanner::kEndOfFile);
+
+  ParseResult pr;
+  pr.ast(old->program);
+  return finish(pr, length);
+} /* Parser::Reparse() */
+
+void Parser::Reset(void) {
+  if (arena_ != NULL && arena_.use_count() == 1) {
+    arena_->Reset();
+  } else {
+    // A ParseResult still holds the last tree; it owns the arena now.
+    arena_.reset();
+  }
+  symbols_ = NULL;
+  outline_ = NULL;
+  spans_.clear();
+  stmt_stack_.clear();
+  expr_stack_.clear();
+  errors_.clear();
+  panicking_ = false;
+  curr_token_ = scanner::CompactToken();
+  prev_token_ = scanner::CompactToken();
+  if (scanner_ != NULL) {
+    scanner_->Start("", 0);
+  }
+} /* Parser::Reset() */
+
 /*
  * parse methods for non-terminal symbols
  * --------------------------------------
@@ -83,15 +162,22 @@ ParseResult Parser::ParseProgram() {
   // root
   // Program ::= varName '(' ')' '{' Stmts '}'
   match(scanner::kVariableName);
-  std::string name(prev_token_->lexeme());
+  ast::Symbol name = intern(prev_token_);
   match(scanner::kLeftParen);
   match(scanner::kRightParen);
   match(scanner::kLeftCurly);
-  ParseResult pr_stmts = parse_stmts();
-  ast::Stmts* ss = (ast::Stmts*) pr_stmts.ast();
+  ast::Program* result_ast =
+      make_node<ast::Program>(name, static_cast<ast::Stmts *>(NULL));
+  outline_ = NULL;
+  if (errors_.empty()) {
+    outline_ = make_node<ParseOutline>();
+    outline_->program = result_ast;
+    outline_->body_begin = prev_token_.offset + prev_token_.length;
+    outline_->header_reach = scanner_->reach();
+  }
+  parse_body(result_ast, NULL, 0, 0, 0, 0);
   match(scanner::kRightCurly);
   match(scanner::kEndOfFile);
-  ast::Program* result_ast = new ast::Program(name, ss);
   pr.ast(result_ast);
   return pr;
 } /* Parser::ParseProgram() */
@@ -107,36 +193,33 @@ ParseResult Parser::parse_matrix_decl() {
   ParseResult pr;
   match(scanner::kMatrixKwd);
   match(scanner::kVariableName);
-  std::string var_name = prev_token_->lexeme();
+  ast::Symbol var_name = intern(prev_token_);
 
   // Decl ::= 'matrix' varName '[' Expr ':' Expr ']' varName ':' varName  '='
   // Expr ';'
   if (attempt_match(scanner::kLeftSquare)) {
-    ParseResult temp = parse_expr(0);
-    ast::Expr* left = (ast::Expr*) temp.ast();
+    ast::Expr* left = parse_expr(0);
     match(scanner::kColon);
-    temp = parse_expr(0);
-    ast::Expr* right = (ast::Expr*) temp.ast();
+    ast::Expr* right = parse_expr(0);
     match(scanner::kRightSquare);
-    ast::VarExpr* temp_s = (ast::VarExpr*) parse_variable_name().ast();
-    std::string l_name = temp_s->name();
+    match(scanner::kVariableName);
+    ast::Symbol l_name = intern(prev_token_);
     match(scanner::kColon);
-    temp_s = (ast::VarExpr*) parse_variable_name().ast();
-    std::string r_name =  temp_s->name();
+    match(scanner::kVariableName);
+    ast::Symbol r_name = intern(prev_token_);
     match(scanner::kAssign);
-    temp = parse_expr(0);
-    ast::Expr* expr = (ast::Expr*) temp.ast();
-    ast::LongMatrixDecl* result_ast = new
-          ast::LongMatrixDecl(var_name, left, right, l_name, r_name, expr);
+    ast::Expr* expr = parse_expr(0);
+    ast::LongMatrixDecl* result_ast = make_node<ast::LongMatrixDecl>(
+        var_name, left, right, l_name, r_name, expr);
     pr.ast(result_ast);
   } else if (attempt_match(scanner::kAssign)) {
     // Decl ::= 'matrix' varName '=' Expr ';'
-    ParseResult temp = parse_expr(0);
-    ast::Expr* expr = (ast::Expr*) temp.ast();
-    ast::ShortMatrixDecl* result_ast = new ast::ShortMatrixDecl(var_name, expr);
+    ast::Expr* expr = parse_expr(0);
+    ast::ShortMatrixDecl* result_ast =
+        make_node<ast::ShortMatrixDecl>(var_name, expr);
     pr.ast(result_ast);
   } else {
-    throw((std::string) "Bad Syntax of Matrix Decl in in parseMatrixDecl");
+    error("Bad Syntax of Matrix Decl in in parseMatrixDecl");
   }
   match(scanner::kSemiColon);
   return pr;
@@ -155,29 +238,29 @@ ParseResult Parser::parse_standard_decl() {
   if (attempt_match(scanner::kIntKwd)) {
     // Type ::= intKwd
     match(scanner::kVariableName);
-    std::string temp = prev_token_->lexeme();
-    ast::IntDecl* result_ast = new ast::IntDecl(temp);
+    ast::Symbol temp = intern(prev_token_);
+    ast::IntDecl* result_ast = make_node<ast::IntDecl>(temp);
     match(scanner::kSemiColon);
     pr.ast(result_ast);
   } else if (attempt_match(scanner::kFloatKwd)) {
     // Type ::= floatKwd
     match(scanner::kVariableName);
-    std::string temp = prev_token_->lexeme();
-    ast::FloatDecl* result_ast = new ast::FloatDecl(temp);
+    ast::Symbol temp = intern(prev_token_);
+    ast::FloatDecl* result_ast = make_node<ast::FloatDecl>(temp);
     match(scanner::kSemiColon);
     pr.ast(result_ast);
   } else if (attempt_match(scanner::kStringKwd)) {
     // Type ::= stringKwd
     match(scanner::kVariableName);
-    std::string temp = prev_token_->lexeme();
-    ast::StringDecl* result_ast = new ast::StringDecl(temp);
+    ast::Symbol temp = intern(prev_token_);
+    ast::StringDecl* result_ast = make_node<ast::StringDecl>(temp);
     match(scanner::kSemiColon);
     pr.ast(result_ast);
   } else if (attempt_match(scanner::kBoolKwd)) {
     // Type ::= boolKwd
     match(scanner::kVariableName);
-    std::string temp = prev_token_->lexeme();
-    ast::BooleanDecl* result_ast = new ast::BooleanDecl(temp);
+    ast::Symbol temp = intern(prev_token_);
+    ast::BooleanDecl* result_ast = make_node<ast::BooleanDecl>(temp);
     match(scanner::kSemiColon);
     pr.ast(result_ast);
   }
@@ -202,30 +285,139 @@ ParseResult Parser::parse_decl() {
 }
 
 /*!
- *  The parse_stmts() method parse a sequence of Stmt, branckes out the first
- * stmt and the rests, and the rests will recursively be brancked out by further
- * calls to this function.
+ *  The parse_stmts() method parses a sequence of Stmt, up to the '}', 'in' or
+ * end of file after it, onto stmt_stack_, and then moves them into the
+ * array of the returned Stmts.
  */
 // Stmts
 ParseResult Parser::parse_stmts() {
   ParseResult pr;
-  if (!next_is(scanner::kRightCurly) && !next_is(scanner::kInKwd)) {
-    // Stmts ::= Stmt Stmts
-    ParseResult pr_stmt = parse_stmt();
-    ast::Stmt* s = (ast::Stmt*) pr_stmt.ast();
-    ParseResult pr_stmts = parse_stmts();
-    ast::Stmts* ss = (ast::Stmts*) pr_stmts.ast();
-    ast::MultiStmts* result_ast = new ast::MultiStmts(s, ss);
-    pr.ast(result_ast);
-  } else {
-    // Stmts ::=
-    // nothing to match.k
-    ast::EmptyStmts* result_ast = new ast::EmptyStmts();
-    pr.ast(result_ast);
+  size_t base = stmt_stack_.size();
+  // Stmts ::= Stmt Stmts
+  while (!next_is(scanner::kRightCurly) && !next_is(scanner::kInKwd) &&
+         !next_is(scanner::kEndOfFile)) {
+    stmt_stack_.push_back(static_cast<ast::Stmt *>(parse_stmt().ast()));
+    if (panicking_) {
+      synchronize();
+    }
   }
+  // Stmts ::=
+  pr.ast(pop_stmts(base));
   return pr;
 }
 
+/* Moves the statements pushed since [base] into an array in the arena. */
+ast::Stmts *Parser::pop_stmts(size_t base) {
+  size_t size = stmt_stack_.size() - base;
+  ast::Stmt **stmts = NULL;
+  if (size > 0) {
+    stmts = static_cast<ast::Stmt **>(
+        arena_->Allocate(size * sizeof(*stmts), alignof(ast::Stmt *)));
+    std::copy(stmt_stack_.begin() + base, stmt_stack_.end(), stmts);
+    stmt_stack_.resize(base);
+  }
+  return make_node<ast::Stmts>(stmts, size);
+} /* Parser::pop_stmts() */
+
+/*!
+ *  The parse_body() method parses the statements of the program's body, up
+ * to the '}' that closes it, into the body's array, and records in spans_
+ * where the ones that parse cleanly lie.
+ *
+ *  When reparsing, [old] is the outline of the previous parse, whose spans
+ * from number [first] on may be reused; the body's statements before span
+ * [first] are kept. Once the parser is at or past [reuse_from] in the new
+ * text, the text from there to the end is as it was, so if a reusable
+ * statement started there it parses just as it did: it is taken as it is,
+ * together with those that directly followed it, and parsing goes on after
+ * them. A span's reach covers everything before it too, as the scanner's
+ * does; [reach] is that of the kept statements, which the scanner did not
+ * see.
+ */
+void Parser::parse_body(ast::Program *program, const ParseOutline *old,
+                        size_t first, size_t reuse_from, size_t new_length,
+                        size_t reach) {
+  size_t base = stmt_stack_.size();
+  ast::Stmt **old_body = NULL;
+  if (old != NULL) {
+    old_body = program->stmts()->begin();
+    if (first > 0) {
+      stmt_stack_.insert(stmt_stack_.end(), old_body,
+                         old_body + old->spans[first - 1].index + 1);
+    }
+  }
+
+  size_t next_old = first;
+  for (;;) {
+    if (old != NULL && !panicking_ && curr_token_.offset >= reuse_from) {
+      size_t at = curr_token_.offset + old->text_length - new_length;
+      while (next_old < old->num_spans && old->spans[next_old].begin < at) {
+        next_old++;
+      }
+      if (next_old < old->num_spans && old->spans[next_old].begin == at) {
+        size_t shift_end = 0;
+        do {
+          StmtSpan span = old->spans[next_old++];
+          span.begin = span.begin + new_length - old->text_length;
+          span.end = span.end + new_length - old->text_length;
+          span.next = span.next + new_length - old->text_length;
+          span.reach = std::max(span.reach + new_length - old->text_length,
+                                std::max(reach, scanner_->reach()));
+          reach = span.reach;
+          stmt_stack_.push_back(old_body[span.index]);
+          span.index = stmt_stack_.size() - base - 1;
+          spans_.push_back(span);
+          shift_end = span.end;
+        } while (next_old < old->num_spans &&
+                 old->spans[next_old].begin == old->spans[next_old - 1].next);
+        scanner_->Seek(shift_end);
+        curr_token_ = scanner_->Next();
+        continue;
+      }
+    }
+    if (next_is(scanner::kRightCurly) || next_is(scanner::kInKwd) ||
+        next_is(scanner::kEndOfFile)) {
+      break;
+    }
+
+    StmtSpan span;
+    span.begin = curr_token_.offset;
+    size_t num_errors = errors_.size();
+    stmt_stack_.push_back(static_cast<ast::Stmt *>(parse_stmt().ast()));
+    if (outline_ != NULL && errors_.size() == num_errors) {
+      span.end = prev_token_.offset + prev_token_.length;
+      span.next = curr_token_.offset;
+      span.reach = std::max(reach, scanner_->reach());
+      span.index = stmt_stack_.size() - base - 1;
+      spans_.push_back(span);
+    }
+    if (panicking_) {
+      synchronize();
+    }
+  }
+
+  // A reparse refills the old body's array if it is big enough; when it is
+  // not, the new one gets room to grow.
+  size_t size = stmt_stack_.size() - base;
+  size_t capacity = (outline_ != NULL) ? outline_->body_capacity : 0;
+  ast::Stmt **stmts = old_body;
+  if (size > capacity) {
+    capacity = std::max(size, 2 * capacity);
+    stmts = static_cast<ast::Stmt **>(
+        arena_->Allocate(capacity * sizeof(*stmts), alignof(ast::Stmt *)));
+    if (outline_ != NULL) {
+      outline_->body_capacity = capacity;
+    }
+  }
+  std::copy(stmt_stack_.begin() + base, stmt_stack_.end(), stmts);
+  stmt_stack_.resize(base);
+  if (program->stmts() == NULL) {
+    program->set_stmts(make_node<ast::Stmts>(stmts, size));
+  } else {
+    program->stmts()->set_stmts(stmts, size);
+  }
+} /* Parser::parse_body() */
+
 /*!
  *  The parse_stmt() function will parse the stmt syntax and recognize the type
  * of stmt, the ast feild of returned ParseResult may be DeclStmt*, BlockStmt*,
@@ -241,13 +433,13 @@ ParseResult Parser::parse_stmt() {
       next_is(scanner::kMatrixKwd) || next_is(scanner::kStringKwd) ||
       next_is(scanner::kBoolKwd)) {
     ast::Decl* temp = (ast::Decl*) parse_decl().ast();
-    ast::DeclStmt* result_ast = new ast::DeclStmt(temp);
+    ast::DeclStmt* result_ast = make_node<ast::DeclStmt>(temp);
     pr.ast(result_ast);
 
   } else if (attempt_match(scanner::kLeftCurly)) {
     // Stmt ::= '{' Stmts '}'
     ast::Stmts* temp = (ast::Stmts*) parse_stmts().ast();
-    ast::BlockStmt* result_ast = new ast::BlockStmt(temp);
+    ast::BlockStmt* result_ast = make_node<ast::BlockStmt>(temp);
     match(scanner::kRightCurly);
     pr.ast(result_ast);
 
@@ -255,16 +447,17 @@ ParseResult Parser::parse_stmt() {
     // Stmt ::= 'if' '(' Expr ')' Stmt
     // Stmt ::= 'if' '(' Expr ')' Stmt 'else' Stmt
     match(scanner::kLeftParen);
-    ast::Expr* expr = (ast::Expr*) parse_expr(0).ast();
+    ast::Expr* expr = parse_expr(0);
     match(scanner::kRightParen);
     ast::Stmt* temp_l = (ast::Stmt*) parse_stmt().ast();
 
     if (attempt_match(scanner::kElseKwd)) {
       ast::Stmt* temp_r = (ast::Stmt*) parse_stmt().ast();
-      ast::IfElseStmt* result_ast = new ast::IfElseStmt(expr, temp_l, temp_r);
+      ast::IfElseStmt* result_ast =
+          make_node<ast::IfElseStmt>(expr, temp_l, temp_r);
       pr.ast(result_ast);
     } else {
-      ast::IfStmt* result_ast = new ast::IfStmt(expr, temp_l);
+      ast::IfStmt* result_ast = make_node<ast::IfStmt>(expr, temp_l);
       pr.ast(result_ast);
     }
 
@@ -273,23 +466,22 @@ ParseResult Parser::parse_stmt() {
      * Stmt ::= varName '=' Expr ';'  | varName '[' Expr ':' Expr ']'
      * '=' Expr ';'
      */
-    bool matrix = false;
-    std::string var_name = prev_token_->lexeme();
+    ast::Symbol var_name = intern(prev_token_);
     if (attempt_match(scanner::kLeftSquare)) {
-      ast::Expr* le = (ast::Expr*) parse_expr(0).ast();
+      ast::Expr* le = parse_expr(0);
       match(scanner::kColon);
-      ast::Expr* re = (ast::Expr*) parse_expr(0).ast();
+      ast::Expr* re = parse_expr(0);
       match(scanner::kRightSquare);
       match(scanner::kAssign);
-      ast::Expr* ex = (ast::Expr*) parse_expr(0).ast();
+      ast::Expr* ex = parse_expr(0);
       match(scanner::kSemiColon);
-      ast::MatrixAssignStmt* result_ast = new
-                              ast::MatrixAssignStmt(var_name, le, re, ex);
+      ast::MatrixAssignStmt* result_ast =
+          make_node<ast::MatrixAssignStmt>(var_name, le, re, ex);
       pr.ast(result_ast);
   } else {
       match(scanner::kAssign);
-      ast::Expr* ex = (ast::Expr*) parse_expr(0).ast();
-      ast::AssignStmt* result_ast = new ast::AssignStmt(var_name, ex);
+      ast::Expr* ex = parse_expr(0);
+      ast::AssignStmt* result_ast = make_node<ast::AssignStmt>(var_name, ex);
       match(scanner::kSemiColon);
       pr.ast(result_ast);
   }
@@ -297,43 +489,44 @@ ParseResult Parser::parse_stmt() {
   } else if (attempt_match(scanner::kPrintKwd)) {
     // Stmt ::= 'print' '(' Expr ')' ';'
     match(scanner::kLeftParen);
-    ast::Expr* ex = (ast::Expr*) parse_expr(0).ast();
+    ast::Expr* ex = parse_expr(0);
     match(scanner::kRightParen);
     match(scanner::kSemiColon);
-    ast::PrintStmt* result_ast = new ast::PrintStmt(ex);
+    ast::PrintStmt* result_ast = make_node<ast::PrintStmt>(ex);
     pr.ast(result_ast);
 
   } else if (attempt_match(scanner::kRepeatKwd)) {
     // Stmt ::= 'repeat' '(' varName '=' Expr 'to' Expr ')' Stmt
     match(scanner::kLeftParen);
     match(scanner::kVariableName);
-    std::string var_name = prev_token_->lexeme();
+    ast::Symbol var_name = intern(prev_token_);
     match(scanner::kAssign);
-    ast::Expr* le = (ast::Expr*) parse_expr(0).ast();
+    ast::Expr* le = parse_expr(0);
     match(scanner::kToKwd);
-    ast::Expr* ue = (ast::Expr*) parse_expr(0).ast();
+    ast::Expr* ue = parse_expr(0);
     match(scanner::kRightParen);
     ast::Stmt* ss = (ast::Stmt*) parse_stmt().ast();
-    ast::RepeatStmt* result_ast = new ast::RepeatStmt(var_name, le, ue, ss);
+    ast::RepeatStmt* result_ast =
+        make_node<ast::RepeatStmt>(var_name, le, ue, ss);
     pr.ast(result_ast);
 
   } else if (attempt_match(scanner::kWhileKwd)) {
     // Stmt ::= 'while' '(' Expr ')' Stmt
     match(scanner::kLeftParen);
-    ast::Expr* ex = (ast::Expr*) parse_expr(0).ast();
+    ast::Expr* ex = parse_expr(0);
     match(scanner::kRightParen);
     ast::Stmt* ss = (ast::Stmt*) parse_stmt().ast();
-    ast::WhileStmt* result_ast = new ast::WhileStmt(ex, ss);
+    ast::WhileStmt* result_ast = make_node<ast::WhileStmt>(ex, ss);
     pr.ast(result_ast);
 
   } else if (attempt_match(scanner::kSemiColon)) {
     // Stmt ::= ';
     // parsed a skip
-    ast::EmptyStmt* result_ast = new ast::EmptyStmt();
+    ast::EmptyStmt* result_ast = make_node<ast::EmptyStmt>();
     pr.ast(result_ast);
 
   } else {
-    throw(make_error_msg(curr_token_->terminal()) +
+    error(make_error_msg(curr_token_.terminal) +
           " while parsing a statement");
   }
   // Stmt ::= variableName assign Expr semiColon
@@ -341,18 +534,53 @@ ParseResult Parser::parse_stmt() {
 }
 
 // Expr
-ParseResult Parser::parse_expr(int rbp) {
+ast::Expr *Parser::parse_expr(int rbp) {
   /* Examine current token, without consuming it, to call its
-     associated parse methods.  The ExtToken objects have 'nud' and
-     'led' methods that are dispatchers that call the appropriate
-     parse methods.*/
-  ParseResult left = curr_token_->nud();
+     associated parse methods.  The 'nud' and 'led' entries of its rule
+     in kTokenRules are the parse methods to dispatch to.  A token with
+     no 'led' cannot continue an expression, whatever its binding power.
+     Once an error is found no token is consumed, so neither handler is
+     called again until the parser has resynchronized.
+
+     Rather than calling parse_expr() again for the operands they need,
+     the handlers push a frame onto expr_stack_ (see expect_operand()),
+     so this loop parses expressions of any depth without recursing.  The
+     frame at [base] stands for the caller, which wants one operand bound
+     as [rbp] says.*/
+  size_t base = expr_stack_.size();
+  expect_operand(rbp, NULL);
+  ast::Expr *expr = NULL;
+  for (;;) {
+    if (expr == NULL && !panicking_) {
+      NudHandler nud = token_rule(curr_token_.terminal).nud;
+      if (nud == NULL) {
+        error((std::string) "Expected an expression but found " +
+              token_rule(curr_token_.terminal).description);
+      } else {
+        expr = (this->*nud)();
+        if (expr == NULL && !panicking_) {
+          continue;  // it wants an operand first
+        }
+      }
+    }
 
-  while (rbp < curr_token_->lbp()) {
-    left = curr_token_->led(left);
-  }
+    if (!panicking_) {
+      const TokenRule &rule = token_rule(curr_token_.terminal);
+      if (expr_stack_.back().rbp < rule.lbp && rule.led != NULL) {
+        (this->*rule.led)(expr);
+        expr = NULL;
+        continue;
+      }
+    }
 
-  return left;
+    // [expr] is the operand of the frame on top, which can now go on.
+    ExprFrame frame = expr_stack_.back();
+    expr_stack_.pop_back();
+    if (expr_stack_.size() == base) {
+      return expr;
+    }
+    expr = (this->*frame.finish)(frame, expr);
+  }
 }
 
 /*
@@ -362,310 +590,248 @@ ParseResult Parser::parse_expr(int rbp) {
 
  /*!
   *  The parse_true_kwd() function will parse the "true" keyword and return a
-  * ParseResult object with its ast feild being TrueExpr*.
+  * TrueExpr*.
   */
 // Expr ::= trueKwd
-ParseResult Parser::parse_true_kwd() {
-  ParseResult pr;
+ast::Expr *Parser::parse_true_kwd() {
   match(scanner::kTrueKwd);
-  ast::TrueExpr* resultAst = new ast::TrueExpr();
-  pr.ast(resultAst);
-  return pr;
+  return make_node<ast::TrueExpr>();
 }
 
 /*!
  *  The parse_false_kwd() function will parse the "false" keyword and return a
- * ParseResult object with its ast feild being FalseExpr*.
+ * FalseExpr*.
  */
 // Expr ::= falseKwd
-ParseResult Parser::parse_false_kwd() {
-  ParseResult pr;
+ast::Expr *Parser::parse_false_kwd() {
   match(scanner::kFalseKwd);
-  ast::FalseExpr* resultAst = new ast::FalseExpr();
-  pr.ast(resultAst);
-  return pr;
+  return make_node<ast::FalseExpr>();
 }
 
 /*!
- *  The parse_int_const() function will parse the intConst keyword and return a
- * ParseResult object with its ast feild being IntConstExpr*.
+ *  The parse_int_const() function will parse the intConst keyword and return
+ * an IntConstExpr*.
  */
 // Expr ::= intConst
-ParseResult Parser::parse_int_const() {
-  ParseResult pr;
+ast::Expr *Parser::parse_int_const() {
   match(scanner::kIntConst);
-  ast::IntConstExpr* resultAst = new ast::IntConstExpr(prev_token_->lexeme());
-  pr.ast(resultAst);
-  return pr;
+  return make_node<ast::IntConstExpr>(lexeme(prev_token_));
 }
 
 /*!
  *  The parse_float_const() function will parse the floatConst keyword and
- * return a ParseResult object with its ast feild being FloatConstExpr*.
+ * return a FloatConstExpr*.
  */
 // Expr ::= floatConst
-ParseResult Parser::parse_float_const() {
-  ParseResult pr;
+ast::Expr *Parser::parse_float_const() {
   match(scanner::kFloatConst);
-  ast::FloatConstExpr* resultAst = new
-               ast::FloatConstExpr(prev_token_->lexeme());
-  pr.ast(resultAst);
-  return pr;
+  return make_node<ast::FloatConstExpr>(lexeme(prev_token_));
 }
 
 /*!
  *  The parse_string_const() function will parse the stringConst keyword and
- * return a ParseResult object with its ast feild being StringConstExpr*.
+ * return a StringConstExpr*.
  */
 // Expr ::= stringConst
-ParseResult Parser::parse_string_const() {
-  ParseResult pr;
+ast::Expr *Parser::parse_string_const() {
   match(scanner::kStringConst);
-  ast::StringConstExpr* resultAst = new
-                      ast::StringConstExpr(prev_token_->lexeme());
-  pr.ast(resultAst);
-  return pr;
+  return make_node<ast::StringConstExpr>(lexeme(prev_token_));
 }
 
 /*!
  *  The parse_variable_name() function will parse the variableName keyword and
- * return a ParseResult object with its ast feild being either MatrixRefExpr*,
- * VarExpr* or GroupExpr*.
+ * return a VarExpr*, or begin a MatrixRefExpr* or FuncCallExpr*.
  */
 // Expr ::= variableName .....
-ParseResult Parser::parse_variable_name() {
-  ParseResult pr;
+ast::Expr *Parser::parse_variable_name() {
   match(scanner::kVariableName);
-  ast::VarExpr* varexpr = new ast::VarExpr(prev_token_->lexeme());
+  ast::Symbol name = intern(prev_token_);
   if (attempt_match(scanner::kLeftSquare)) {
     // Expr ::= varName '[' Expr ':' Expr ']'
-    ParseResult tem = parse_expr(0);
-    ast::Expr* expr_left = (ast::Expr*) tem.ast();
-    match(scanner::kColon);
-    tem = parse_expr(0);
-    ast::Expr* expr_right = (ast::Expr*) tem.ast();
-    match(scanner::kRightSquare);
-    ast::MatrixRefExpr* result_ast = new
-                ast::MatrixRefExpr(varexpr->UnParse(), expr_left, expr_right);
-    pr.ast(result_ast);
+    expect_operand(0, &Parser::finish_matrix_row).name = name;
+    return NULL;
   }  else if (attempt_match(scanner::kLeftParen)) {
     // Expr ::= varableName '(' Expr ')'
-    ParseResult tem = parse_expr(0);
-    match(scanner::kRightParen);
-    ast::Expr* expr = (ast::Expr*) tem.ast();
-    ast::FuncCallExpr* result_ast =
-                   new ast::FuncCallExpr(varexpr->UnParse(), expr);
-    pr.ast(result_ast);
-    // pr.ast((ast::GroupExpr*) new ast::GroupExpr(expr));
-  } else {
-    // variable
-    pr.ast(varexpr);
+    expect_operand(0, &Parser::finish_call).name = name;
+    return NULL;
   }
-  return pr;
+  // variable
+  return make_node<ast::VarExpr>(name);
+}
+
+ast::Expr *Parser::finish_matrix_row(const ExprFrame &frame,
+                                     ast::Expr *operand) {
+  match(scanner::kColon);
+  ExprFrame &next = expect_operand(0, &Parser::finish_matrix_ref);
+  next.name = frame.name;
+  next.first = operand;
+  return NULL;
+}
+
+ast::Expr *Parser::finish_matrix_ref(const ExprFrame &frame,
+                                     ast::Expr *operand) {
+  match(scanner::kRightSquare);
+  return make_node<ast::MatrixRefExpr>(frame.name, frame.first, operand);
+}
+
+ast::Expr *Parser::finish_call(const ExprFrame &frame, ast::Expr *operand) {
+  match(scanner::kRightParen);
+  return make_node<ast::FuncCallExpr>(frame.name, operand);
 }
 
 /*!
- *  The parse_nested_expr() function will parse syntax with structure:
- * Expr ::= leftParen Expr rightParen and return a ParseResult object with its
- * ast field being GroupExpr*.
+ *  The parse_nested_expr() function will begin parsing syntax with
+ * structure: Expr ::= leftParen Expr rightParen, which finish_nested_expr()
+ * completes as a GroupExpr*.
  */
 // Expr ::= leftParen Expr rightParen
-ParseResult Parser::parse_nested_expr() {
-  ParseResult pr;
+ast::Expr *Parser::parse_nested_expr() {
   match(scanner::kLeftParen);
-  ParseResult tem = parse_expr(0);
-  ast::Expr* expr = (ast::Expr*) tem.ast();
-  pr.ast((ast::GroupExpr*) new ast::GroupExpr(expr));
+  expect_operand(0, &Parser::finish_nested_expr);
+  return NULL;
+}
+
+ast::Expr *Parser::finish_nested_expr(const ExprFrame &frame,
+                                      ast::Expr *operand) {
   match(scanner::kRightParen);
-  return pr;
+  return make_node<ast::GroupExpr>(operand);
 }
 
 /*!
- *  The parse_if_expr() function will parse syntax with structure:
- * Expr ::= 'if' Expr 'then' Expr 'else' Expr and return a ParseResult object
- * with its ast feild being IfExpr*.
+ *  The parse_if_expr() function will begin parsing syntax with structure:
+ * Expr ::= 'if' Expr 'then' Expr 'else' Expr, one operand at a time, which
+ * finish_if_expr() completes as an IfExpr*.
  */
 // Expr ::= 'if' Expr 'then' Expr 'else' Expr
-ParseResult Parser::parse_if_expr() {
-  ParseResult pr;
-
+ast::Expr *Parser::parse_if_expr() {
   match(scanner::kIfKwd);
-  ParseResult tem = parse_expr(0);
-  ast::Expr* ex1 = (ast::Expr*) tem.ast();
+  expect_operand(0, &Parser::finish_if_cond);
+  return NULL;
+}
+
+ast::Expr *Parser::finish_if_cond(const ExprFrame &frame,
+                                  ast::Expr *operand) {
   match(scanner::kThenKwd);
-  tem = parse_expr(0);
-  ast::Expr* ex2 = (ast::Expr*) tem.ast();
-  match(scanner::kElseKwd);
-  tem = parse_expr(0);
-  ast::Expr* ex3 = (ast::Expr*) tem.ast();
+  expect_operand(0, &Parser::finish_if_then).first = operand;
+  return NULL;
+}
 
-  ast::IfExpr* ifex = new ast::IfExpr(ex1, ex2, ex3);
-  pr.ast(ifex);
+ast::Expr *Parser::finish_if_then(const ExprFrame &frame,
+                                  ast::Expr *operand) {
+  match(scanner::kElseKwd);
+  ExprFrame &next = expect_operand(0, &Parser::finish_if_expr);
+  next.first = frame.first;
+  next.second = operand;
+  return NULL;
+}
 
-  return pr;
+ast::Expr *Parser::finish_if_expr(const ExprFrame &frame,
+                                  ast::Expr *operand) {
+  return make_node<ast::IfExpr>(frame.first, frame.second, operand);
 }
 
 /*!
- *  The parse_let_expr() function will parse syntax with structure:
- * Expr ::= 'let' Stmts 'in' Expr 'end' and return a ParseResult object
- * with its ast feild being LetExpr*.
+ *  The parse_let_expr() function will begin parsing syntax with structure:
+ * Expr ::= 'let' Stmts 'in' Expr 'end', which finish_let_expr() completes
+ * as a LetExpr*.
  */
 // Expr ::= 'let' Stmts 'in' Expr 'end'
-ParseResult Parser::parse_let_expr() {
-  ParseResult pr;
+ast::Expr *Parser::parse_let_expr() {
   match(scanner::kLetKwd);
-  ParseResult tem = parse_stmts();
-  ast::Stmts* stmts = (ast::Stmts*) tem.ast();
+  ast::Stmts* stmts = (ast::Stmts*) parse_stmts().ast();
   match(scanner::kInKwd);
-  tem = parse_expr(0);
-  ast::Expr* expr = (ast::Expr*) tem.ast();
-  match(scanner::kEndKwd);
-  ast::LetExpr* letex = new ast::LetExpr(stmts, expr);
-  pr.ast(letex);
+  expect_operand(0, &Parser::finish_let_expr).stmts = stmts;
+  return NULL;
+}
 
-  return pr;
+ast::Expr *Parser::finish_let_expr(const ExprFrame &frame,
+                                   ast::Expr *operand) {
+  match(scanner::kEndKwd);
+  return make_node<ast::LetExpr>(frame.stmts, operand);
 }
 
 /*!
- *  The parse_not_expr() function will parse syntax with structure:
- * Expr ::= '!' Expr and return a ParseResult object with its ast feild being
- * NotExpr*.
+ *  The parse_not_expr() function will begin parsing syntax with structure:
+ * Expr ::= '!' Expr, which finish_not_expr() completes as a NotExpr*.
  */
 // Expr ::= '!' Expr
-ParseResult Parser::parse_not_expr() {
-  ParseResult pr;
+ast::Expr *Parser::parse_not_expr() {
   match(scanner::kNotOp);
-  ParseResult tem = parse_expr(0);
-  pr.ast((ast::NotExpr*) tem.ast());
-  return pr;
+  expect_operand(0, &Parser::finish_not_expr);
+  return NULL;
 }
 
-/*!
- *  The parse_addition() function will parse syntax with structure:
- * Expr ::= Expr plusSign Expr and return a ParseResult object with its ast
- * feild being PlusExpr*.
- */
-// Expr ::= Expr plusSign Expr
-ParseResult Parser::parse_addition(ParseResult prLeft) {
-  // parser has already matched left expression
-  ast::Expr* expr_left = (ast::Expr*) prLeft.ast();
-  ParseResult pr;
-  match(scanner::kPlusSign);
-  ParseResult tem = parse_expr(prev_token_->lbp());
-  ast::Expr* expr_right = (ast::Expr*) tem.ast();
-  ast::PlusExpr* plusex = new ast::PlusExpr(expr_left, expr_right);
-  pr.ast(plusex);
-  return pr;
+ast::Expr *Parser::finish_not_expr(const ExprFrame &frame,
+                                   ast::Expr *operand) {
+  return make_node<ast::NotExpr>(operand);
 }
 
-/*!
- *  The parse_multiplication() function will parse syntax with structure:
- * Expr ::= Expr star Expr and return a ParseResult object with its ast
- * feild being MulExpr*.
- */
+// Expr ::= Expr plusSign Expr
 // Expr ::= Expr star Expr
-ParseResult Parser::parse_multiplication(ParseResult prLeft) {
-  // parser has already matchekD left expression
-  ast::Expr* expr_left = (ast::Expr*) prLeft.ast();
-  ParseResult pr;
-  match(scanner::kStar);
-  ParseResult tem = parse_expr(prev_token_->lbp());
-  ast::Expr* expr_right = (ast::Expr*) tem.ast();
-  ast::MulExpr* mulex = new ast::MulExpr(expr_left, expr_right);
-  pr.ast(mulex);
-  return pr;
-}
-
-/*!
- *  The parse_subtraction() function will parse syntax with structure:
- * Expr ::= Expr dash Expr and return a ParseResult object with its ast
- * feild being MinusExpr*.
- */
 // Expr ::= Expr dash Expr
-ParseResult Parser::parse_subtraction(ParseResult prLeft) {
-  // parser has already matchekD left expression
-  ast::Expr* expr_left = (ast::Expr*) prLeft.ast();
-  ParseResult pr;
-  match(scanner::kDash);
-  ParseResult tem = parse_expr(prev_token_->lbp());
-  ast::Expr* expr_right = (ast::Expr*) tem.ast();
-  ast::MinusExpr* minusex = new ast::MinusExpr(expr_left, expr_right);
-  pr.ast(minusex);
-  return pr;
-}
-
-/*!
- *  The parse_division() function will parse syntax with structure:
- * Expr ::= Expr forwardSlash Expr and return a ParseResult object with its ast
- * feild being DivExpr*.
- */
 // Expr ::= Expr forwardSlash Expr
-ParseResult Parser::parse_division(ParseResult prLeft) {
-  // parser has already matchekD left expression
-  ast::Expr* expr_left = (ast::Expr*) prLeft.ast();
-  ParseResult pr;
-  match(scanner::kForwardSlash);
-  ParseResult tem = parse_expr(prev_token_->lbp());
-  ast::Expr* expr_right = (ast::Expr*) tem.ast();
-  ast::DivExpr* divex = new ast::DivExpr(expr_left, expr_right);
-  pr.ast(divex);
-  return pr;
-}
-
 // Expr ::= Expr equalEquals Expr
 // Expr ::= Expr lessThanEquals Expr
 // Expr ::= Expr greaterThanEquals Expr
 // Expr ::= Expr notEquals Expr
 // Expr ::= Expr leftAngle Expr
 // Expr ::= Expr rightAngle Expr
-/* Notice that for relational operators we use just one parse
-   function.  This shows another possible means for implementing
-   expressions, as opposed to the method used for arithmetic
-   expressions in which each operation has its own parse method.  It
-   will depend on what we do in iteration 3 in building an abstract
-   syntax tree to decide which method is better.
+/* All the binary operators share one parse function: it only has to note
+   the operator and its left operand, which finish_binary_expr() turns
+   into the node for that operator once the right operand is parsed.
 */
-ParseResult Parser::parse_relational_expr(ParseResult prLeft) {
-  // parser has already matched left expression
-  ast::Expr* expr_left = (ast::Expr*) prLeft.ast();
-  ParseResult pr;
-
+void Parser::parse_binary_expr(ast::Expr *left) {
   next_token();
   // just advance token, since examining it in parse_expr caused
   // this method being called.
-  std::string op = prev_token_->lexeme();
-
-  ParseResult tem = parse_expr(prev_token_->lbp());
-  ast::Expr* expr_right = (ast::Expr*) tem.ast();
-  ast::Expr* result;
-  if (op == "==") {
-      result = new ast::EqualEqualExpr(expr_left, expr_right);
-  } else if (op == "<=") {
-      result = new ast::LessEqualExpr(expr_left, expr_right);
-  } else if (op == ">=") {
-      result = new ast::GreaterEqualExpr(expr_left, expr_right);
-  } else if (op == "!=") {
-      result = new ast::NotEqualExpr(expr_left, expr_right);
-  } else if (op == "<") {
-      result = new ast::LessExpr(expr_left, expr_right);
-  } else {
-      result = new ast::GreaterExpr(expr_left, expr_right);
-  }
+  scanner::TokenType op = prev_token_.terminal;
+  ExprFrame &frame = expect_operand(token_rule(op).lbp,
+                                    &Parser::finish_binary_expr);
+  frame.op = op;
+  frame.first = left;
+}
 
-  pr.ast(result);
-  return pr;
+ast::Expr *Parser::finish_binary_expr(const ExprFrame &frame,
+                                      ast::Expr *operand) {
+  ast::Expr *left = frame.first;
+  switch (frame.op) {
+    case scanner::kPlusSign:
+      return make_node<ast::PlusExpr>(left, operand);
+    case scanner::kStar:
+      return make_node<ast::MulExpr>(left, operand);
+    case scanner::kDash:
+      return make_node<ast::MinusExpr>(left, operand);
+    case scanner::kForwardSlash:
+      return make_node<ast::DivExpr>(left, operand);
+    case scanner::kEqualsEquals:
+      return make_node<ast::EqualEqualExpr>(left, operand);
+    case scanner::kLessThanEqual:
+      return make_node<ast::LessEqualExpr>(left, operand);
+    case scanner::kGreaterThanEqual:
+      return make_node<ast::GreaterEqualExpr>(left, operand);
+    case scanner::kNotEquals:
+      return make_node<ast::NotEqualExpr>(left, operand);
+    case scanner::kLessThan:
+      return make_node<ast::LessExpr>(left, operand);
+    default:
+      return make_node<ast::GreaterExpr>(left, operand);
+  } /* switch() */
 }
 
 // Helper function used by the parser.
 
-void Parser::match(const scanner::TokenType &tt) {
+bool Parser::match(const scanner::TokenType &tt) {
   if (!attempt_match(tt)) {
-    throw(make_error_msg_expected(tt));
+    error(make_error_msg_expected(tt));
+    return false;
   }
+  return true;
 }
 
 bool Parser::attempt_match(const scanner::TokenType &tt) {
-  if (curr_token_->terminal() == tt) {
+  // Nothing matches while panicking, so that the broken statement is
+  // abandoned without consuming anything; synchronize() skips past it.
+  if (!panicking_ && curr_token_.terminal == tt) {
     next_token();
     return true;
   }
@@ -673,33 +839,18 @@ bool Parser::attempt_match(const scanner::TokenType &tt) {
 }
 
 bool Parser::next_is(const scanner::TokenType &tt) {
-  return curr_token_->terminal() == tt;
+  return curr_token_.terminal == tt;
 }
 
 void Parser::next_token() {
-  if (curr_token_ == NULL) {
-    throw(std::string(
-        "Internal Error: should not call nextToken in unitialized state"));
-  } else if (curr_token_->terminal() == scanner::kEndOfFile &&
-           curr_token_->next() == NULL) {
-    prev_token_ = curr_token_;
-  } else if (curr_token_->terminal() != scanner::kEndOfFile &&
-             curr_token_->next() == NULL) {
-    throw(make_error_msg("Error: tokens end with endOfFile"));
-  } else {
-    prev_token_ = curr_token_;
-    curr_token_ = curr_token_->next();
+  if (scanner_ == NULL) {
+    error("Internal Error: should not call nextToken in unitialized state");
+    return;
+  }
+  prev_token_ = curr_token_;
+  if (curr_token_.terminal != scanner::kEndOfFile) {
+    curr_token_ = scanner_->Next();
   }
-}
-
-std::string Parser::terminal_description(const scanner::TokenType &terminal) {
-  scanner::Token *dummy_token = new scanner::Token("", terminal, NULL);
-  scanner::ExtToken *dummy_ext_token = new scanner::ExtToken(this, dummy_token);
-  dummy_ext_token->ExtendToken(this, dummy_token);
-  std::string s = dummy_ext_token->description();
-  delete dummy_token;
-  delete dummy_ext_token;
-  return s;
 }
 
 std::string Parser::make_error_msg_expected(
@@ -709,8 +860,8 @@ std::string Parser::make_error_msg_expected(
     ss << terminal;
     std::string str = ss.str();
 
-  std::string s = (std::string) "Expected " + terminal_description(terminal) +
-                   str + " but found " + curr_token_->description();
+  std::string s = (std::string) "Expected " + str + " but found " +
+                   token_rule(curr_token_.terminal).description;
   return s;
 }
 
@@ -719,11 +870,94 @@ std::string Parser::make_error_msg(const scanner::TokenType &terminal) {
     ss << terminal;
     std::string str = ss.str();
 
-  std::string s = "Unexpected symbol " + terminal_description(terminal) + str;
+  std::string s = "Unexpected symbol " + str;
   return s;
 }
 
 std::string Parser::make_error_msg(const char *msg) { return msg; }
 
+/*
+ * Records an error at the current token, unless the parser is already
+ * recovering from one: whatever goes wrong before it resynchronizes is
+ * most likely fallout from the first error, so it is not reported.
+ */
+void Parser::error(const std::string &msg) {
+  if (panicking_) {
+    return;
+  }
+  ParseError e;
+  e.offset = curr_token_.offset;
+  e.message = msg;
+  errors_.push_back(e);
+  panicking_ = true;
+} /* Parser::error() */
+
+/*
+ * Completes a parse or reparse of [length] bytes: stores the spans of its
+ * outline, and hands the result its tree, arena and outline, or its errors.
+ * A failed parse keeps its arena only if it has an outline.
+ */
+ParseResult Parser::finish(ParseResult pr, size_t length) {
+  if (outline_ != NULL) {
+    if (spans_.size() > outline_->capacity) {
+      size_t capacity = std::max(spans_.size(), 2 * outline_->capacity);
+      outline_->spans = static_cast<StmtSpan *>(arena_->Allocate(
+          capacity * sizeof(StmtSpan), alignof(StmtSpan)));
+      outline_->capacity = capacity;
+    }
+    std::copy(spans_.begin(), spans_.end(), outline_->spans);
+    outline_->num_spans = spans_.size();
+    outline_->text_length = length;
+  }
+
+  if (!errors_.empty()) {
+    std::string messages = errors_[0].message;
+    for (size_t i = 1; i < errors_.size(); i++) {
+      messages += "\n" + errors_[i].message;
+    }
+    pr.ok(false);
+    pr.errors(messages);
+    pr.error_list(errors_);
+    pr.ast(NULL);
+  }
+  if (errors_.empty() || outline_ != NULL) {
+    pr.arena(arena_);
+    pr.symbols(symbols_);
+    pr.outline(outline_);
+  }
+  return pr;
+} /* Parser::finish() */
+
+/*
+ * Panic-mode recovery: skips tokens up to the end of the broken statement,
+ * a ';' (which is consumed) or the '}' closing its block (which is left for
+ * the block to match), and resumes normal parsing from there. Blocks opened
+ * in what is skipped, as when an if or while header is broken, are skipped
+ * whole, up to their '}'; the statement ends there unless an else follows.
+ */
+void Parser::synchronize(void) {
+  size_t depth = 0;
+  while (!next_is(scanner::kEndOfFile)) {
+    if (next_is(scanner::kLeftCurly)) {
+      depth++;
+    } else if (next_is(scanner::kRightCurly)) {
+      if (depth == 0) {
+        break;
+      }
+      next_token();
+      if (--depth == 0 && !next_is(scanner::kElseKwd)) {
+        panicking_ = false;
+        return;
+      }
+      continue;
+    } else if (next_is(scanner::kSemiColon) && depth == 0) {
+      break;
+    }
+    next_token();
+  }
+  panicking_ = false;
+  attempt_match(scanner::kSemiColon);
+} /* Parser::synchronize() */
+
 } /* namespace parser */
 } /* namespace fcal */
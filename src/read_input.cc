@@ -5,16 +5,21 @@
  * Description     : Implementation of input reader utility
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Eric Van Wyk
- * Modifications by: John Harwell
+ * Modifications by: John Harwell, Son Nguyen, Yu Fang
  ******************************************************************************/
 
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include "../include/read_input.h"
 
 /*******************************************************************************
@@ -23,6 +28,106 @@
 namespace fcal {
 namespace scanner {
 
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* How much read() asks for at a time when the input cannot be mapped. */
+static const size_t kReadChunk = 64 * 1024;
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+/**
+ * InputBuffer::Open() - Map [filename] if it is a regular file, otherwise
+ * read it to the end.
+ *
+ * RETURN:
+ *     bool - false if the file could not be opened or read.
+ **/
+bool InputBuffer::Open(const char *filename) {
+  Reset();
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = ReadFrom(fd);
+  close(fd);
+  return ok;
+} /* InputBuffer::Open() */
+
+/**
+ * InputBuffer::ReadFrom() - Take in everything left on [fd]. A regular file
+ * read from its start (as stdin is under "< file") is mapped; a pipe,
+ * socket or terminal is read until end of file. [fd] is left open.
+ *
+ * RETURN:
+ *     bool - false if [fd] could not be read.
+ **/
+bool InputBuffer::ReadFrom(int fd) {
+  Reset();
+  struct stat filestatus;
+  if (fstat(fd, &filestatus) != 0) {
+    return false;
+  }
+
+  bool regular = S_ISREG(filestatus.st_mode);
+  if (regular && filestatus.st_size > 0 && lseek(fd, 0, SEEK_CUR) == 0) {
+    size_t size = static_cast<size_t>(filestatus.st_size);
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      // The scanner reads the file once, front to back.
+      madvise(map, size, MADV_SEQUENTIAL);
+      data_ = static_cast<const char *>(map);
+      size_ = size;
+      mapped_ = true;
+      return true;
+    }
+  }
+  return ReadAll(fd, regular ? static_cast<size_t>(filestatus.st_size) : 0);
+} /* InputBuffer::ReadFrom() */
+
+void InputBuffer::Reset(void) {
+  if (mapped_) {
+    munmap(const_cast<char *>(data_), size_);
+  }
+  std::vector<char>().swap(buffer_);
+  data_ = "";
+  size_ = 0;
+  mapped_ = false;
+} /* InputBuffer::Reset() */
+
+/*
+ * Read [fd] to the end into buffer_, a chunk at a time. The buffer grows
+ * geometrically, and is NUL-terminated past size() for callers that want a
+ * C string.
+ */
+bool InputBuffer::ReadAll(int fd, size_t size_hint) {
+  size_t used = 0;
+  buffer_.resize(size_hint + kReadChunk);
+  for (;;) {
+    if (buffer_.size() - used < kReadChunk) {
+      buffer_.resize(buffer_.size() * 2);
+    }
+    ssize_t n = read(fd, &buffer_[used], buffer_.size() - used - 1);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      Reset();
+      return false;
+    }
+    if (n == 0) {
+      break;
+    }
+    used += static_cast<size_t>(n);
+  } /* for() */
+
+  buffer_[used] = '\0';
+  data_ = &buffer_[0];
+  size_ = used;
+  return true;
+} /* InputBuffer::ReadAll() */
+
 /*******************************************************************************
  * Functions
  ******************************************************************************/
@@ -30,54 +135,54 @@ namespace scanner {
  * ReadInputFromFile() - Do the actual reading of the file into the buffer
  *
  * RETURN:
- *     char* - The buffer, or NULL if an error occurred.
+ *     char* - The NUL-terminated buffer, or NULL if an error occurred.
  **/
 char *ReadInputFromFile(const char *filename) {
-  FILE *in_fp;
-  in_fp = fopen(filename, "r");
-
-  if (in_fp == NULL) {
+  InputBuffer input;
+  if (!input.Open(filename)) {
     printf("File \"%s\" not found.\n", filename);
     fflush(stdout);
     return NULL;
   }
 
-  // Determine the size of the file, used to allocate the char buffer.
-  struct stat filestatus;
-  stat(filename, &filestatus);
-
-  int filesize = filestatus.st_size + 1;  // +1 for terminating null char
-
-  // Allocate space for the character buffer.
-  char *buffer = new char[filesize];
+  char *buffer = new char[input.size() + 1];
+  memcpy(buffer, input.data(), input.size());
+  buffer[input.size()] = '\0';
+  return buffer;
+} /* ReadInputFromFile() */
 
-  int index = 0;
-  char ch = getc(in_fp);
 
-  while (ch != EOF) {
-    buffer[index] = ch;
-    index++;
-    ch = getc(in_fp);
+/**
+ * ReadInputFromFd() - Read everything left on [fd] into a buffer, without
+ * staging it anywhere on disk. [fd] is left open.
+ *
+ * RETURN:
+ *     char* - The NUL-terminated buffer, or NULL if an error occurred.
+ **/
+char *ReadInputFromFd(int fd) {
+  InputBuffer input;
+  if (!input.ReadFrom(fd)) {
+    return NULL;
   }
-  buffer[index] = '\0';
 
+  char *buffer = new char[input.size() + 1];
+  memcpy(buffer, input.data(), input.size());
+  buffer[input.size()] = '\0';
   return buffer;
-} /* ReadInputFromFile() */
-
+} /* ReadInputFromFd() */
 
 /**
- * ReadInput() - Read a file into a char buffer. The calling function is
- * responsible for disposing of the return memory.
+ * ReadInput() - Read the file named by argv[1], or standard input, into a
+ * char buffer. The calling function is responsible for disposing of the
+ * return memory.
  *
  * RETURN:
  *     char* - The buffer, or NULL if an error occurred.
  **/
 char *ReadInput(int argc, char **argv) {
-  // Verify that a file name is provided and that the file exists.
-  // Use some new C++ stream features.
-  if (argc <= 1) {
-    //        printf ("Usage: %s <filename>\n", argv[0]) ;
-    return NULL;
+  // With no file name, or with "-", read the program from standard input.
+  if (argc <= 1 || strcmp(argv[1], "-") == 0) {
+    return ReadInputFromFd(STDIN_FILENO);
   } else {
     return ReadInputFromFile(argv[1]);
   }
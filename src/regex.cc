@@ -3,19 +3,18 @@
  * Project         : fcal
  * Module          : scanner
  * Description     : This file provides the [makeRegex] and [matchRegex]
- *                   functions.
+ *                   functions, backed by a lazily built DFA.
  * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
  * Original Author : Eric Van Wyk
- * Modifications by: Dan Challou, John Harwell
+ * Modifications by: Dan Challou, John Harwell, Son Nguyen, Yu Fang
  ******************************************************************************/
 
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <stdio.h>
-#include <stdlib.h>
-#include <regex.h>
+#include <algorithm>
 #include <cstddef>
+#include <vector>
 #include "../include/regex.h"
 
 /*******************************************************************************
@@ -24,48 +23,231 @@
 namespace fcal {
 namespace scanner {
 
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+static const int kUnknownState = -1;
+static const int kDeadState = 0;
+static const int kStartState = 1;
+
+/* The most NFA state numbers the cached DFA states may hold in total. */
+static const size_t kMaxCachedSetSize = 1 << 16;
+
 /*******************************************************************************
  * Functions
  ******************************************************************************/
-regex_t* make_regex(const char* pattern) {
-  regex_t *re = new regex_t;
-  int rc;
+/* FNV-1a over the NFA state numbers of a DFA state. */
+static unsigned hash_set(const std::vector<int> &set) {
+  unsigned hash = 2166136261u;
+  for (size_t i = 0; i < set.size(); i++) {
+    hash = (hash ^ static_cast<unsigned>(set[i])) * 16777619u;
+  }
+  return hash;
+}
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+Regex::Regex(void)
+    : nfa_(), classes_(), representative_(), num_classes_(0), next_(),
+      accept_(), set_begin_(), sets_(), table_(), num_states_(0),
+      start_set_(), closure_(), stack_(), mark_(), generation_(0) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+bool Regex::Compile(const char *pattern) {
+  if (!nfa_.AddPattern(pattern, 0)) {
+    return false;
+  }
+  std::vector<int> representative;
+  num_classes_ = nfa_.ByteClasses(classes_, &representative);
+  representative_.assign(representative.begin(), representative.end());
 
   /*
-   * "Compile" the regular expression.  This sets up the regex to do the
-   * matching specified by the regular expression given as a character string.
+   * A DFA state is the set of NFA char and match states it stands for, kept
+   * sorted. Size everything for the worst case up front so that Match()
+   * never has to grow a vector.
    */
-  rc = regcomp(re, pattern, REG_EXTENDED);
+  size_t n = nfa_.num_states();
+  closure_.reserve(n);
+  stack_.reserve(n);
+  mark_.assign(n, 0);
+  next_.assign(kRegexMaxCachedStates * num_classes_, kUnknownState);
+  accept_.assign(kRegexMaxCachedStates, false);
+  set_begin_.assign(kRegexMaxCachedStates + 1, 0);
+  sets_.resize(std::max(std::min(n * kRegexMaxCachedStates,
+                                 kMaxCachedSetSize), 3 * n));
+  table_.assign(2 * kRegexMaxCachedStates, kUnknownState);
+
+  generation_ = 1;
+  AddToClosure(nfa_.start());
+  std::sort(closure_.begin(), closure_.end());
+  start_set_ = closure_;
+  Flush();
+  return true;
+} /* Regex::Compile() */
+
+int Regex::Match(const char *text) {
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(text);
+  int state = kStartState;
+  int matched = 0;
+
+  for (const unsigned char *p = s; *p != '\0'; p++) {
+    int cls = classes_[*p];
+    int next = next_[state * num_classes_ + cls];
+    if (next == kUnknownState) {
+      next = Step(state, cls);
+    }
+    if (next == kDeadState) {
+      break;
+    }
+    state = next;
+    if (accept_[state]) {
+      matched = static_cast<int>(p - s) + 1;
+    }
+  }
+  return matched;
+} /* Regex::Match() */
+
+/*
+ * Add NFA state [s] and everything reachable from it by epsilon edges to
+ * closure_, keeping only the states that consume a byte or accept.
+ */
+void Regex::AddToClosure(int s) {
+  if (s == kNfaNoState || mark_[s] == generation_) {
+    return;
+  }
+  mark_[s] = generation_;
+  stack_.clear();
+  stack_.push_back(s);
+  while (!stack_.empty()) {
+    int t = stack_.back();
+    stack_.pop_back();
+    const NfaState &state = nfa_.state(t);
+    if (state.kind != NfaState::kSplitState) {
+      closure_.push_back(t);
+      continue;
+    }
+    int edges[2] = { state.out, state.out1 };
+    for (int e = 0; e < 2; e++) {
+      if (edges[e] != kNfaNoState && mark_[edges[e]] != generation_) {
+        mark_[edges[e]] = generation_;
+        stack_.push_back(edges[e]);
+      }
+    }
+  } /* while() */
+} /* Regex::AddToClosure() */
+
+/*
+ * Work out where DFA state [state] goes on byte class [cls] and cache the
+ * answer. If the cache is full it is flushed first; the transition is then
+ * not cached, since [state] no longer exists.
+ */
+int Regex::Step(int state, int cls) {
+  int byte = representative_[cls];
+  if (++generation_ == 0) {
+    std::fill(mark_.begin(), mark_.end(), 0);
+    generation_ = 1;
+  }
+  closure_.clear();
+  for (int i = set_begin_[state]; i < set_begin_[state + 1]; i++) {
+    const NfaState &s = nfa_.state(sets_[i]);
+    if (s.kind == NfaState::kCharState && s.chars.test(byte)) {
+      AddToClosure(s.out);
+    }
+  }
+  std::sort(closure_.begin(), closure_.end());
 
-  if (rc!= 0) {
-    // printf ("Error in compiling regular expression.\n");
-    std::size_t length = regerror(rc, re, NULL, 0);
-    char *buffer = new char[length];
-    (void) regerror(rc, re, buffer, length);
+  int target = FindState();
+  if (target != kUnknownState) {
+    next_[state * num_classes_ + cls] = target;
+    return target;
+  }
+  if (num_states_ == kRegexMaxCachedStates ||
+      set_begin_[num_states_] + closure_.size() > sets_.size()) {
+    closure_.swap(stack_);  // Flush() reuses closure_
+    Flush();
+    closure_.swap(stack_);
+    target = FindState();
+    return target != kUnknownState ? target : AddState();
+  }
+  target = AddState();
+  next_[state * num_classes_ + cls] = target;
+  return target;
+} /* Regex::Step() */
+
+/* Hash closure_ and probe for a cached state with the same set. */
+int Regex::FindState(void) const {
+  unsigned hash = hash_set(closure_);
+  size_t mask = table_.size() - 1;
+  for (size_t i = hash & mask; table_[i] != kUnknownState;
+       i = (i + 1) & mask) {
+    int id = table_[i];
+    size_t len = set_begin_[id + 1] - set_begin_[id];
+    if (len == closure_.size() &&
+        std::equal(closure_.begin(), closure_.end(),
+                   sets_.begin() + set_begin_[id])) {
+      return id;
+    }
+  }
+  return kUnknownState;
+} /* Regex::FindState() */
+
+/* Cache closure_ as a new DFA state; the caller has checked there is room. */
+int Regex::AddState(void) {
+  int id = num_states_++;
+  bool accepts = false;
+  int at = set_begin_[id];
+  for (size_t i = 0; i < closure_.size(); i++) {
+    sets_[at + i] = closure_[i];
+    accepts |= nfa_.state(closure_[i]).kind == NfaState::kMatchState;
+  }
+  set_begin_[id + 1] = at + static_cast<int>(closure_.size());
+  accept_[id] = accepts;
+
+  unsigned hash = hash_set(closure_);
+  size_t mask = table_.size() - 1;
+  size_t slot = hash & mask;
+  while (table_[slot] != kUnknownState) {
+    slot = (slot + 1) & mask;
+  }
+  table_[slot] = id;
+  return id;
+} /* Regex::AddState() */
+
+/* Forget every cached state except the dead state and the start state. */
+void Regex::Flush(void) {
+  num_states_ = 0;
+  std::fill(next_.begin(), next_.end(), kUnknownState);
+  std::fill(table_.begin(), table_.end(), kUnknownState);
+
+  closure_.clear();
+  AddState();
+  std::fill(next_.begin(), next_.begin() + num_classes_, kDeadState);
+  closure_ = start_set_;
+  AddState();
+} /* Regex::Flush() */
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+regex_t* make_regex(const char* pattern) {
+  regex_t *re = new regex_t;
+  if (!re->Compile(pattern)) {
     delete re;
     return NULL;
-  } else {
-    return re;
   }
+  return re;
 } /* make_regex() */
 
 int match_regex(regex_t *re, const char *text) {
-  int status;
-  regmatch_t matches[kRegexNSub];
-
-  /*
-   * Execute the regular expression match against the text. If it matches, the
-   * beginning and ending of the matched text are stored in the first element
-   * of the matches array.
-   */
-  status = regexec(re, text, static_cast<size_t>(kRegexNSub), matches, 0);
-
-  if (status == REG_NOMATCH) {
-    return 0;
-  } else {
-    return matches[0].rm_eo;
-  }
+  return re->Match(text);
 } /* match_regex() */
 
+void free_regex(regex_t *re) {
+  delete re;
+} /* free_regex() */
+
 } /* namespace scanner */
 } /* namespace fcal */
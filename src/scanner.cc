@@ -1,469 +1,392 @@
-/*******************************************************************************
- * Name            : scanner.cc
- * Project         : fcal
- * Module          : scanner
- * Description     : This file provides the scan method for scanner
- * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
- * Original Author : Son Nguyen
- * Modifications by: Son Nguyen, Yu Fang
- ******************************************************************************/
-
-/*******************************************************************************
- * Includes
- ******************************************************************************/
-#include <stdio.h>
-#include <stdlib.h>
-#include <regex.h>
-#include <string.h>
-#include <iostream>
-#include "../include/regex.h"
-#include "../include/scanner.h"
-// #include "../include/token.h"
-
-/*******************************************************************************
- * Namespaces
- ******************************************************************************/
-namespace fcal {
-namespace scanner {
-
-/*******************************************************************************
- * Functions
- ******************************************************************************/
-  int string_not_equal(const char* l, const char* s, int count) {
-    if (count != strlen(s))
-        return 1;
-    for (int i = 0; i < count; i++) {
-        if (l[i] != s[i])
-            return 1;
-    }
-    return 0;
-  }
-
-  int consume_whitespace_and_comments(regex_t *line_comment,
-                                    regex_t *white_space,
-                                    regex_t *block_comment,
-                                    const char *text) {
-    int num_matched_chars = 0;
-    int total_num_matched_chars = 0;
-    int still_consuming_white_space;
-
-    do {
-      still_consuming_white_space = 0;  //  exit loop if not reset by a match
-
-      //  Try to match white space
-      num_matched_chars = match_regex(white_space, text);
-      total_num_matched_chars += num_matched_chars;
-      if (num_matched_chars > 0) {
-        text = text + num_matched_chars;
-        still_consuming_white_space = 1;
-      }
-
-      //  Try to match block comments
-      num_matched_chars = match_regex(block_comment, text);
-      total_num_matched_chars += num_matched_chars;
-      if (num_matched_chars > 0) {
-        text = text + num_matched_chars;
-        still_consuming_white_space = 1;
-      }
-
-      //  Try to match line comments
-      num_matched_chars = match_regex(line_comment, text);
-      total_num_matched_chars += num_matched_chars;
-      if (num_matched_chars > 0) {
-        text = text + num_matched_chars;
-        still_consuming_white_space = 1;
-      }
-    } while (still_consuming_white_space);
-
-    return total_num_matched_chars;
-} /* consume_whitespace_and_comments() */
-
-
-/*extract firts count chars of text*/
-char * substring(const char* text, int count) {
-    char *result = reinterpret_cast<char*>(malloc(strlen(text) + 1));
-    if (count > strlen(text)) {
-        result[0] = '\0';
-        return result;
-    }
-    for (int i = 0; i < count; i++) {
-        result[i] = text[i];
-    }
-    result[count] = '\0';
-    return result;
-}/*substring*/
-
-/*Scan - return a list of Token */
-Token *Scanner :: Scan(const char * text) {
-    // init_regex();
-
-    regex_t *white_space = new regex_t;
-    white_space = make_regex("^[\n\t\r ]+");
-    regex_t *block_comment = new regex_t;
-    block_comment = make_regex("^/\\*([^\\*]|\\*+[^\\*/])*\\*+/");
-    regex_t *line_comment = new regex_t;
-    line_comment = make_regex("^//[^\n]*\n");
-    text += consume_whitespace_and_comments(line_comment,
-                             white_space, block_comment, text);
-
-    Token* result = new Token();
-    Token* ptr = result;
-
-    Result tem;
-    while (strlen(text)) {
-    Token *a = new Token();
-        tem = find_TokenType(text);
-        if (tem.type == kEndOfFile && strlen(text)) {
-            ptr->set_terminal(kLexicalError);
-            ptr->set_lexeme(substring(text, 1));
-            ptr->set_next(a);
-            text += 1;
-            text += consume_whitespace_and_comments(line_comment, white_space,
-                block_comment, text);
-            ptr = ptr->next();
-        } else {
-            ptr->set_terminal(tem.type);
-            ptr->set_lexeme(substring(text, tem.length));
-            ptr->set_next(a);
-            text = text + tem.length;
-            text += consume_whitespace_and_comments(line_comment, white_space,
-                block_comment, text);
-            ptr = ptr->next();
-        }
-    }
-
-    return result;
-}/*Scan*/
-
-/*find_TokenType - helper function for Scan - takes in a string text and return
-a struct Result which has the length of the element and TokenType.
-It will search until a match is found, if there is no match, return kEndOfFile.
-It will not return kLexicalError, this error will be spotted in Scan */
-Result Scanner :: find_TokenType(const char * text) {
-    // init_regex();
-    Result result;
-
-    // Variable name
-    if (match_regex(regexes[kVariableName], text)) {
-        int count = match_regex(regexes[kVariableName], text);
-        if (string_not_equal(text, "int", count) &&
-            string_not_equal(text, "float", count) &&
-            string_not_equal(text, "string", count) &&
-            string_not_equal(text, "matrix", count) &&
-            string_not_equal(text, "boolean", count) &&
-            string_not_equal(text, "True", count) &&
-            string_not_equal(text, "False", count) &&
-            string_not_equal(text, "let", count) &&
-            string_not_equal(text, "in", count) &&
-            string_not_equal(text, "end", count) &&
-            string_not_equal(text, "if", count) &&
-            string_not_equal(text, "then", count) &&
-            string_not_equal(text, "else", count) &&
-            string_not_equal(text, "repeat", count) &&
-            string_not_equal(text, "while", count) &&
-            string_not_equal(text, "print", count) &&
-            string_not_equal(text, "to", count) ) {
-                result.length = match_regex(regexes[kVariableName], text);
-                result.type = kVariableName;
-                return result;
-            }
-    }
-
-    // Keywords
-    if (match_regex(regexes[kWhileKwd], text)) {
-        result.length = match_regex(regexes[kWhileKwd], text);
-        result.type = kWhileKwd;
-        return result;
-    }
-    if (match_regex(regexes[kBoolKwd], text)) {
-        result.length = match_regex(regexes[kBoolKwd], text);
-        result.type = kBoolKwd;
-        return result;
-    }
-    if (match_regex(regexes[kTrueKwd], text)) {
-        result.length = match_regex(regexes[kTrueKwd], text);
-        result.type = kTrueKwd;
-        return result;
-    }
-    if (match_regex(regexes[kFalseKwd], text)) {
-        result.length = match_regex(regexes[kFalseKwd], text);
-        result.type = kFalseKwd;
-        return result;
-    }
-    if (match_regex(regexes[kIntKwd], text)) {
-        result.length = match_regex(regexes[kIntKwd], text);
-        result.type = kIntKwd;
-        return result;
-    }
-    if (match_regex(regexes[kFloatKwd], text)) {
-        result.length = match_regex(regexes[kFloatKwd], text);
-        result.type = kFloatKwd;
-        return result;
-    }
-    if (match_regex(regexes[kStringKwd], text)) {
-        result.length = match_regex(regexes[kStringKwd], text);
-        result.type = kStringKwd;
-        return result;
-    }
-    if (match_regex(regexes[kMatrixKwd], text)) {
-        result.length = match_regex(regexes[kMatrixKwd], text);
-        result.type = kMatrixKwd;
-        return result;
-    }
-    if (match_regex(regexes[kLetKwd], text)) {
-        result.length = match_regex(regexes[kLetKwd], text);
-        result.type = kLetKwd;
-        return result;
-    }
-    if (match_regex(regexes[kInKwd], text)) {
-        result.length = match_regex(regexes[kInKwd], text);
-        result.type = kInKwd;
-        return result;
-    }
-    if (match_regex(regexes[kEndKwd], text)) {
-        result.length = match_regex(regexes[kEndKwd], text);
-        result.type = kEndKwd;
-        return result;
-    }
-    if (match_regex(regexes[kIfKwd], text)) {
-        result.length = match_regex(regexes[kIfKwd], text);
-        result.type = kIfKwd;
-        return result;
-    }
-    if (match_regex(regexes[kThenKwd], text)) {
-        result.length = (match_regex(regexes[kThenKwd], text));
-        result.type = kThenKwd;
-        return result;
-    }
-    if (match_regex(regexes[kElseKwd], text)) {
-        result.length = match_regex(regexes[kElseKwd], text);
-        result.type = kElseKwd;
-        return result;
-    }
-    if (match_regex(regexes[kRepeatKwd], text)) {
-        result.length = match_regex(regexes[kRepeatKwd], text);
-        result.type = kRepeatKwd;
-        return result;
-    }
-    if (match_regex(regexes[kPrintKwd], text)) {
-        result.length = match_regex(regexes[kPrintKwd], text);
-        result.type = kPrintKwd;
-        return result;
-    }
-    if (match_regex(regexes[kToKwd], text)) {
-        result.length = match_regex(regexes[kToKwd], text);
-        result.type = kToKwd;
-        return result;
-    }
-
-    // Constants
-    if (match_regex(regexes[kFloatConst], text)) {
-        result.length = match_regex(regexes[kFloatConst], text);
-        result.type = kFloatConst;
-        return result;
-    }
-    if (match_regex(regexes[kIntConst], text)) {
-        result.length = match_regex(regexes[kIntConst], text);
-        result.type = kIntConst;
-        return result;
-    }
-    if (match_regex(regexes[kStringConst], text)) {
-        result.length = match_regex(regexes[kStringConst], text);
-        result.type = kStringConst;
-        return result;
-    }
-    // kDash needs to be here
-    if (match_regex(regexes[kDash], text)) {
-        result.length = match_regex(regexes[kDash], text);
-        result.type = kDash;
-        return result;
-    }
-
-    // Punctuation
-    if (match_regex(regexes[kLeftParen], text)) {
-        result.length = match_regex(regexes[kLeftParen], text);
-        result.type = kLeftParen;
-        return result;
-    }
-    if (match_regex(regexes[kRightParen], text)) {
-        result.length = match_regex(regexes[kRightParen], text);
-        result.type = kRightParen;
-        return result;
-    }
-    if (match_regex(regexes[kLeftCurly], text)) {
-        result.length = match_regex(regexes[kLeftCurly], text);
-        result.type = kLeftCurly;
-        return result;
-    }
-    if (match_regex(regexes[kRightCurly], text)) {
-        result.length = match_regex(regexes[kRightCurly], text);
-        result.type = kRightCurly;
-        return result;
-    }
-    if (match_regex(regexes[kLeftSquare], text)) {
-        result.length = match_regex(regexes[kLeftSquare], text);
-        result.type = kLeftSquare;
-        return result;
-    }
-    if (match_regex(regexes[kRightSquare], text)) {
-        result.length = match_regex(regexes[kRightSquare], text);
-        result.type = kRightSquare;
-        return result;
-    }
-
-    if (match_regex(regexes[kSemiColon], text)) {
-        result.length = match_regex(regexes[kSemiColon], text);
-        result.type = kSemiColon;
-        return result;
-    }
-    if (match_regex(regexes[kColon], text)) {
-        result.length = match_regex(regexes[kColon], text);
-        result.type = kColon;
-        return result;
-    }
-
-    // Operations
-  if (match_regex(regexes[kEqualsEquals], text)) {
-        result.length = match_regex(regexes[kEqualsEquals], text);
-        result.type = kEqualsEquals;
-        return result;
-    }
-    if (match_regex(regexes[kAssign], text)) {
-        result.length = match_regex(regexes[kAssign], text);
-        result.type = kAssign;
-        return result;
-    }
-    if (match_regex(regexes[kPlusSign], text)) {
-        result.length = match_regex(regexes[kPlusSign], text);
-        result.type = kPlusSign;
-        return result;
-    }
-    if (match_regex(regexes[kStar], text)) {
-        result.length = match_regex(regexes[kStar], text);
-        result.type = kStar;
-        return result;
-    }
-    if (match_regex(regexes[kForwardSlash], text)) {
-        result.length = match_regex(regexes[kForwardSlash], text);
-        result.type = kForwardSlash;
-        return result;
-    }
-    if (match_regex(regexes[kLessThanEqual], text)) {
-        result.length = match_regex(regexes[kLessThanEqual], text);
-        result.type = kLessThanEqual;
-        return result;
-    }
-    if (match_regex(regexes[kLessThan], text)) {
-        result.length = match_regex(regexes[kLessThan], text);
-        result.type = kLessThan;
-        return result;
-    }
-    if (match_regex(regexes[kGreaterThanEqual], text)) {
-        result.length = match_regex(regexes[kGreaterThanEqual], text);
-        result.type = kGreaterThanEqual;
-        return result;
-    }
-    if (match_regex(regexes[kGreaterThan], text)) {
-        result.length = match_regex(regexes[kGreaterThan], text);
-        result.type = kGreaterThan;
-        return result;
-    }
-    if (match_regex(regexes[kNotEquals], text)) {
-        result.length = match_regex(regexes[kNotEquals], text);
-        result.type = kNotEquals;
-        return result;
-    }
-    if (match_regex(regexes[kAndOp], text)) {
-        result.length = match_regex(regexes[kAndOp], text);
-        result.type = kAndOp;
-        return result;
-    }
-    if (match_regex(regexes[kOrOp], text)) {
-        result.length = match_regex(regexes[kOrOp], text);
-        result.type = kOrOp;
-        return result;
-    }
-    if (match_regex(regexes[kNotOp], text)) {
-        result.length = match_regex(regexes[kNotOp], text);
-        result.type = kNotOp;
-        return result;
-    }
-
-    result.length = 0;
-    result.type = kEndOfFile;
-    return result;
-} /*find_TokenType*/
-
-/*Initialize all the needed regexes*/
-void Scanner :: init_regex() {
-    // Keywords
-    Scanner::regexes[kIntKwd] = make_regex("^int");
-    Scanner::regexes[kFloatKwd] = make_regex("^float");
-    Scanner::regexes[kStringKwd] = make_regex("^string");
-    Scanner::regexes[kMatrixKwd] = make_regex("^matrix");
-    Scanner::regexes[kLetKwd] = make_regex("^let");
-    Scanner::regexes[kInKwd] = make_regex("^in");
-    Scanner::regexes[kEndKwd] = make_regex("^end");
-    Scanner::regexes[kIfKwd] = make_regex("^if");
-    Scanner::regexes[kThenKwd] = make_regex("^then");
-    Scanner::regexes[kElseKwd] = make_regex("^else");
-    Scanner::regexes[kRepeatKwd] = make_regex("^repeat");
-    Scanner::regexes[kPrintKwd] = make_regex("^print");
-    Scanner::regexes[kToKwd] = make_regex("^to");
-    Scanner::regexes[kWhileKwd] = make_regex("^while");
-    Scanner::regexes[kBoolKwd] = make_regex("^boolean");
-    Scanner::regexes[kTrueKwd] = make_regex("^True");
-    Scanner::regexes[kFalseKwd] = make_regex("^False");
-
-    // Constants
-    Scanner::regexes[kIntConst] = make_regex("^[0-9]+");
-    Scanner::regexes[kFloatConst] = make_regex("^[0-9]*\\.[0-9]+");
-    Scanner::regexes[kStringConst] = make_regex("^\"[^\"]*\"");
-
-    // Variable Name
-    Scanner::regexes[kVariableName] = make_regex("^_*[a-zA-Z]+[_a-zA-Z0-9-]*");
-
-    // Punctuation
-    Scanner::regexes[kLeftParen] = make_regex("^\\(");
-    Scanner::regexes[kRightParen] = make_regex("^\\)");
-    Scanner::regexes[kLeftCurly] = make_regex("^\\{");
-    Scanner::regexes[kRightCurly] = make_regex("^\\}");
-    Scanner::regexes[kLeftSquare] = make_regex("^\\[");
-    Scanner::regexes[kRightSquare] = make_regex("^\\]");
-    Scanner::regexes[kSemiColon] = make_regex("^;");
-    Scanner::regexes[kColon] = make_regex("^:");
-
-    // Operations
-    Scanner::regexes[kAssign] = make_regex("^=");
-    Scanner::regexes[kPlusSign] = make_regex("^\\+");
-    Scanner::regexes[kStar] = make_regex("^\\*");
-    Scanner::regexes[kDash] = make_regex("^-");
-    Scanner::regexes[kForwardSlash] = make_regex("^/");
-    Scanner::regexes[kLessThan] = make_regex("^<");
-    Scanner::regexes[kLessThanEqual] = make_regex("^<=");
-    Scanner::regexes[kGreaterThan] = make_regex("^>");
-    Scanner::regexes[kGreaterThanEqual] = make_regex("^>=");
-    Scanner::regexes[kEqualsEquals] = make_regex("^==");
-    Scanner::regexes[kNotEquals] = make_regex("^!=");
-    Scanner::regexes[kAndOp] = make_regex("^&&");
-    Scanner::regexes[kOrOp] = make_regex("^\\|\\|");
-    Scanner::regexes[kNotOp] = make_regex("^!");
-}/*init_regex*/
-
-} /* namespace scanner */
-} /* namespace fcal */
-
- /*int main(){
-  using namespace std;
-  fcal::scanner::Scanner* s = new fcal::scanner::Scanner();
-  fcal::scanner::Result result;
-
-  const char* text= "{int a; @ float b; if (a <= b) # $}";
-  fcal::scanner::Token* token = new fcal::scanner::Token(fcal::scanner::kEndKwd,text,NULL);
-  token = s->Scan(text);
-  while (token->terminal()!= fcal::scanner::kEndOfFile){
-      cout<<token->lexeme()<<"   "<<token->terminal()<<"\n";
-    token = token->next();
-  }
-  exit(1);
-}*/
+/*******************************************************************************
+ * Name            : scanner.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : This file provides the scan method for scanner
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include "../include/dfa.h"
+#include "../include/regex.h"
+#include "../include/scanner.h"
+#include "../include/skip.h"
+#include "../include/thread_pool.h"
+#include "../lexer_tables.h"
+// #include "../include/token.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*Keyword lookup. Every keyword is also a variable name, so the DFA only
+recognizes variable names and this table tells keywords apart afterwards.
+KeywordHash is a perfect hash over the 17 keywords: each lands in its own slot
+of kKeywords, so a lookup is one hash and one comparison.*/
+typedef struct Keyword {
+    const char *text;
+    int length;
+    TokenType terminal;
+} Keyword;
+
+const int kKeywordSlots = 64;
+
+constexpr int KeywordHash(const char *text, int length) {
+    return (length + static_cast<unsigned char>(text[0]) +
+            (static_cast<unsigned char>(text[length - 1]) << 2)) &
+           (kKeywordSlots - 1);
+}
+
+#define NO_KWD { "", 0, kVariableName }
+constexpr Keyword kKeywords[kKeywordSlots] = {
+    /*0*/ NO_KWD, NO_KWD, NO_KWD, { "if", 2, kIfKwd },
+    /*4*/ NO_KWD, { "print", 5, kPrintKwd }, NO_KWD, NO_KWD,
+    /*8*/ { "repeat", 6, kRepeatKwd }, NO_KWD, NO_KWD, NO_KWD,
+    /*12*/ NO_KWD, NO_KWD, NO_KWD, NO_KWD,
+    /*16*/ { "while", 5, kWhileKwd }, NO_KWD, NO_KWD,
+           { "matrix", 6, kMatrixKwd },
+    /*20*/ NO_KWD, { "string", 6, kStringKwd }, NO_KWD, NO_KWD,
+    /*24*/ NO_KWD, NO_KWD, NO_KWD, NO_KWD,
+    /*28*/ NO_KWD, NO_KWD, NO_KWD, { "False", 5, kFalseKwd },
+    /*32*/ NO_KWD, { "boolean", 7, kBoolKwd }, NO_KWD, { "in", 2, kInKwd },
+    /*36*/ NO_KWD, NO_KWD, NO_KWD, NO_KWD,
+    /*40*/ NO_KWD, NO_KWD, NO_KWD, NO_KWD,
+    /*44*/ { "True", 4, kTrueKwd }, NO_KWD, NO_KWD, NO_KWD,
+    /*48*/ { "then", 4, kThenKwd }, NO_KWD, { "to", 2, kToKwd }, NO_KWD,
+    /*52*/ NO_KWD, NO_KWD, NO_KWD, NO_KWD,
+    /*56*/ { "end", 3, kEndKwd }, NO_KWD, NO_KWD, { "float", 5, kFloatKwd },
+    /*60*/ { "int", 3, kIntKwd }, { "else", 4, kElseKwd }, NO_KWD,
+           { "let", 3, kLetKwd }
+};
+#undef NO_KWD
+
+/*Checks at compile time that every keyword sits in the slot it hashes to*/
+constexpr bool keyword_slots_ok(int slot) {
+    return slot == kKeywordSlots ||
+           ((kKeywords[slot].length == 0 ||
+             KeywordHash(kKeywords[slot].text,
+                         kKeywords[slot].length) == slot) &&
+            keyword_slots_ok(slot + 1));
+}
+static_assert(keyword_slots_ok(0), "kKeywords is not a perfect hash table");
+
+TokenType lookup_keyword(const char *text, int length) {
+    const Keyword &kwd = kKeywords[KeywordHash(text, length)];
+    if (kwd.length == length && memcmp(kwd.text, text, length) == 0) {
+        return kwd.terminal;
+    }
+    return kVariableName;
+}/*lookup_keyword*/
+
+/*Start - begin pulling tokens from the [length] bytes at [begin]. Nothing
+past begin + length is read*/
+void Scanner :: Start(const char *begin, size_t length) {
+    text_ = begin;
+    cursor_ = begin;
+    end_ = begin + length;
+    reach_ = 0;
+    ring_head_ = 0;
+    ring_size_ = 0;
+}/*Start*/
+
+void Scanner :: Seek(size_t offset) {
+    assert(text_ + offset <= end_);
+    cursor_ = text_ + offset;
+    ring_head_ = 0;
+    ring_size_ = 0;
+}/*Seek*/
+
+/*extend_reach - note that the scan has looked at the byte at [p], or for
+the end of the text if [p] is there*/
+static inline void extend_reach(size_t *reach, const char *text,
+                                const char *p) {
+    size_t r = static_cast<size_t>(p - text) + 1;
+    if (r > *reach) {
+        *reach = r;
+    }
+}/*extend_reach*/
+
+/*ScanToken - scan the token at the cursor. A character that starts no token
+becomes a one-character kLexicalError token*/
+CompactToken Scanner :: ScanToken() {
+    cursor_ += skip_whitespace_and_comments(cursor_, end_);
+    // The skipper stopped at the cursor, having looked one byte further if
+    // that is a '/', and to the end for a comment that is never closed.
+    if (cursor_ < end_ && *cursor_ == '/') {
+        bool comment = end_ - cursor_ >= 2 &&
+                       (cursor_[1] == '*' || cursor_[1] == '/');
+        extend_reach(&reach_, text_, comment ? end_ : cursor_ + 1);
+    } else {
+        extend_reach(&reach_, text_, cursor_);
+    }
+
+    CompactToken t;
+    t.offset = cursor_ - text_;
+    if (cursor_ < end_) {
+        const char *stop;
+        Result tem = find_TokenType(cursor_, end_, &stop);
+        extend_reach(&reach_, text_, stop);
+        if (tem.type == kEndOfFile) {
+            tem.type = kLexicalError;
+            tem.length = 1;
+        }
+        t.length = tem.length;
+        t.terminal = tem.type;
+        cursor_ += tem.length;
+    } else {
+        t.length = 0;
+        t.terminal = kEndOfFile;
+    }
+    return t;
+}/*ScanToken*/
+
+/*ScanOne - scan the token at the cursor onto the back of the ring*/
+void Scanner :: ScanOne() {
+    assert(ring_size_ < kLookahead);
+    ring_[(ring_head_ + ring_size_) % kLookahead] = ScanToken();
+    ring_size_++;
+}/*ScanOne*/
+
+const CompactToken &Scanner :: Peek(int k) {
+    assert(k >= 0 && k < kLookahead);
+    while (ring_size_ <= k) {
+        ScanOne();
+    }
+    return ring_[(ring_head_ + k) % kLookahead];
+}/*Peek*/
+
+/*Next - take the next token. Unless something has been peeked at, the
+token goes straight from the scanner to the caller, bypassing the ring*/
+CompactToken Scanner :: Next() {
+    if (ring_size_ == 0) {
+        return ScanToken();
+    }
+    CompactToken t = ring_[ring_head_];
+    ring_head_ = (ring_head_ + 1) % kLookahead;
+    ring_size_--;
+    return t;
+}/*Next*/
+
+/*Tokenize - scan the [length] bytes at [begin] into a contiguous stream of
+token spans*/
+void Scanner :: Tokenize(const char *begin, size_t length,
+                         TokenStream *tokens) {
+    tokens->Reset(begin);
+    Start(begin, length);
+    CompactToken t;
+    do {
+        t = Next();
+        tokens->Add(t.terminal, t.offset, t.length);
+    } while (t.terminal != kEndOfFile);
+}/*Tokenize*/
+
+void Scanner :: Tokenize(const char * text, TokenStream *tokens) {
+    Tokenize(text, strlen(text), tokens);
+}/*Tokenize*/
+
+/*find_split_points - walk the text the way the scanner would, but only as
+far as string constants and comments go: no other token can contain a '"',
+a '/' or whitespace, so the walk can jump from one '"' or '/' to the next.
+A string constant or a comment that is never closed is not one, and the
+scanner just moves past its first character; so does the walk. In the
+plain text between, the first whitespace byte past each target is a split
+point*/
+std::vector<size_t> find_split_points(const char *begin, size_t length,
+                                      size_t chunk) {
+    std::vector<size_t> splits;
+    const char *end = begin + length;
+    const char *pos = begin;
+    size_t target = chunk;
+
+    while (chunk > 0 && target < length) {
+        const char *special = find_any_byte(pos, end, '"', '/', '"');
+        const char *w = (pos > begin + target) ? pos : begin + target;
+        while (w < special && *w != ' ' && *w != '\n' && *w != '\t' &&
+               *w != '\r') {
+            w++;
+        }
+        if (w < special) {
+            splits.push_back(w - begin);
+            pos = w;
+            target = splits.back() + chunk;
+        } else if (special == end) {
+            break;
+        } else if (*special == '"') {
+            const char *close = find_any_byte(special + 1, end, '"', '\0',
+                                              '"');
+            pos = (close < end && *close == '"') ? close + 1 : special + 1;
+        } else {
+            size_t skipped = skip_whitespace_and_comments(special, end);
+            pos = (skipped > 0) ? special + skipped : special + 1;
+        }
+    }
+    return splits;
+}/*find_split_points*/
+
+/*make_token_list - the linked list of Token for a token stream*/
+static Token *make_token_list(const TokenStream &tokens) {
+    Token *result = NULL;
+    Token *last = NULL;
+    for (size_t i = 0; i < tokens.size(); i++) {
+        Token *t = new Token(tokens.terminal(i), tokens.lexeme(i), NULL);
+        if (last == NULL) {
+            result = t;
+        } else {
+            last->set_next(t);
+        }
+        last = t;
+    }
+    return result;
+}/*make_token_list*/
+
+/*Scan - return a list of Token, built as the tokens are scanned*/
+Token *Scanner :: Scan(const char *begin, size_t length) {
+    Start(begin, length);
+    Token *result = NULL;
+    Token *last = NULL;
+    CompactToken t;
+    do {
+        t = Next();
+        Token *token = new Token(t.terminal, lexeme(t), NULL);
+        if (last == NULL) {
+            result = token;
+        } else {
+            last->set_next(token);
+        }
+        last = token;
+    } while (t.terminal != kEndOfFile);
+    return result;
+}/*Scan*/
+
+Token *Scanner :: Scan(const char *begin, size_t length, ThreadPool *pool) {
+    TokenStream tokens;
+    Tokenize(begin, length, &tokens, pool);
+    return make_token_list(tokens);
+}/*Scan*/
+
+/*Tokenize - scan the chunks between split points in parallel, each with a
+Scanner of its own, then stitch the chunks' tokens together. Every chunk
+but the last ends in a kEndOfFile that is dropped*/
+void Scanner :: Tokenize(const char *begin, size_t length,
+                         TokenStream *tokens, ThreadPool *pool,
+                         size_t min_chunk) {
+    // A few chunks per thread even out chunks that scan slower.
+    const size_t kChunksPerThread = 4;
+    size_t chunk = length / (pool->size() * kChunksPerThread) + 1;
+    if (chunk < min_chunk) {
+        chunk = min_chunk;
+    }
+    std::vector<size_t> bounds = find_split_points(begin, length, chunk);
+    if (bounds.empty()) {
+        Tokenize(begin, length, tokens);
+        return;
+    }
+    bounds.insert(bounds.begin(), 0);
+    bounds.push_back(length);
+    size_t num_chunks = bounds.size() - 1;
+
+    std::vector<TokenStream> parts(num_chunks);
+    for (size_t i = 0; i < num_chunks; i++) {
+        pool->Submit([begin, &bounds, &parts, i]() {
+            Scanner scanner;
+            scanner.Tokenize(begin + bounds[i], bounds[i + 1] - bounds[i],
+                             &parts[i]);
+        });
+    }
+    pool->Wait();
+
+    std::vector<size_t> first(num_chunks + 1, 0);
+    for (size_t i = 0; i < num_chunks; i++) {
+        size_t kept = parts[i].size() - ((i + 1 < num_chunks) ? 1 : 0);
+        first[i + 1] = first[i] + kept;
+    }
+    tokens->Reset(begin);
+    tokens->Resize(first[num_chunks]);
+    for (size_t i = 0; i < num_chunks; i++) {
+        pool->Submit([tokens, &bounds, &parts, &first, i]() {
+            for (size_t j = 0; first[i] + j < first[i + 1]; j++) {
+                CompactToken t = parts[i][j];
+                t.offset += bounds[i];
+                tokens->Set(first[i] + j, t);
+            }
+        });
+    }
+    pool->Wait();
+}/*Tokenize*/
+
+Token *Scanner :: Scan(const char * text) {
+    return Scan(text, strlen(text));
+}/*Scan*/
+
+/*find_TokenType - helper function for Scan - takes in a string text and return
+a struct Result which has the length of the element and TokenType.
+The DFA returns the longest match, and variable names are then checked
+against the keyword table. If there is no match, return kEndOfFile.
+It will not return kLexicalError, this error will be spotted in Scan */
+Result Scanner :: find_TokenType(const char *text, const char *end,
+                                 const char **stop) {
+    Result result;
+    int tag;
+
+    result.length = static_cast<int>(dfa_match(kTokenDfa, text, end, &tag,
+                                               stop));
+    if (result.length == 0) {
+        result.type = kEndOfFile;
+    } else if (tag == kVariableName) {
+        result.type = lookup_keyword(text, result.length);
+    } else {
+        result.type = static_cast<TokenType>(tag);
+    }
+    return result;
+} /*find_TokenType*/
+
+Result Scanner :: find_TokenType(const char * text) {
+    return find_TokenType(text, text + strlen(text));
+} /*find_TokenType*/
+
+/*Compile the regex for every terminal into regexes[]*/
+void Scanner :: init_regex() {
+    for (int i = 0; i < kNumTokenSpecs; i++) {
+        TokenType terminal = kTokenSpecs[i].terminal;
+        free_regex(regexes[terminal]);
+        regexes[terminal] = make_regex(kTokenSpecs[i].pattern);
+    }
+}/*init_regex*/
+
+Scanner :: ~Scanner() {
+    for (int i = 0; i <= kLexicalError; i++) {
+        free_regex(regexes[i]);
+    }
+}/*~Scanner*/
+
+} /* namespace scanner */
+} /* namespace fcal */
+
+ /*int main(){
+  using namespace std;
+  fcal::scanner::Scanner* s = new fcal::scanner::Scanner();
+  fcal::scanner::Result result;
+
+  const char* text= "{int a; @ float b; if (a <= b) # $}";
+  fcal::scanner::Token* token = new fcal::scanner::Token(fcal::scanner::kEndKwd,text,NULL);
+  token = s->Scan(text);
+  while (token->terminal()!= fcal::scanner::kEndOfFile){
+      cout<<token->lexeme()<<"   "<<token->terminal()<<"\n";
+    token = token->next();
+  }
+  exit(1);
+}*/
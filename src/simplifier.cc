@@ -0,0 +1,358 @@
+/*******************************************************************************
+ * Name            : simplifier.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file implements the pass that folds constants and
+ *                   simplifies the expressions of an AST.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+#include <string>
+#include "../include/simplifier.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/* The value of a number constant, as C++ reads it */
+struct Number {
+  bool is_float;
+  long long int_value;  // NOLINT(runtime/int)
+  float float_value;
+
+  float as_float(void) const {
+    return is_float ? float_value : static_cast<float>(int_value);
+  }
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/*
+ * Reads the value of [expr] into [number] if it is a number constant. An
+ * int constant C++ would read differently, in octal or as a long, is not
+ * read.
+ */
+static bool number(Expr *expr, Number *number) {
+  if (expr->kind() == kIntConstExpr) {
+    const std::string &text = static_cast<IntConstExpr *>(expr)->value();
+    if ((text.size() > 1 && text[0] == '0') || text.size() > 10) {
+      return false;
+    }
+    number->is_float = false;
+    number->int_value = strtoll(text.c_str(), NULL, 10);
+    return number->int_value <= INT_MAX;
+  }
+  if (expr->kind() == kFloatConstExpr) {
+    number->is_float = true;
+    number->float_value =
+        strtof(static_cast<FloatConstExpr *>(expr)->value().c_str(), NULL);
+    return true;
+  }
+  return false;
+} /* number() */
+
+/* Whether [expr] is a number constant equal to [value] */
+static bool is_number(Expr *expr, int value) {
+  Number n;
+  return number(expr, &n) && n.as_float() == value;
+} /* is_number() */
+
+/* Reads the value of [expr] into [value] if it is True or False. */
+static bool boolean(Expr *expr, bool *value) {
+  *value = (expr->kind() == kTrueExpr);
+  return expr->kind() == kTrueExpr || expr->kind() == kFalseExpr;
+} /* boolean() */
+
+/*
+ * Writes [value] as the shortest FCAL float constant that C++ reads back
+ * as [value], if there is one: FCAL has no minus sign and no exponents.
+ */
+static bool float_text(float value, std::string *text) {
+  if (!std::isfinite(value) || std::signbit(value)) {
+    return false;
+  }
+  char buffer[32];
+  for (int digits = 1; digits <= 9; digits++) {
+    snprintf(buffer, sizeof(buffer), "%.*g", digits, value);
+    if (strtof(buffer, NULL) == value) {
+      break;
+    }
+  }
+  if (strchr(buffer, 'e') != NULL) {
+    return false;
+  }
+  *text = buffer;
+  if (strchr(buffer, '.') == NULL) {
+    *text += ".0";
+  }
+  return true;
+} /* float_text() */
+
+template <typename T>
+static bool compare(NodeKind kind, T left, T right) {
+  switch (kind) {
+    case kGreaterExpr: return left > right;
+    case kGreaterEqualExpr: return left >= right;
+    case kLessExpr: return left < right;
+    case kLessEqualExpr: return left <= right;
+    case kEqualEqualExpr: return left == right;
+    default: return left != right;
+  }
+} /* compare() */
+
+/*
+ * How tightly the operator of [node] binds, as the parser has it: more
+ * tightly the higher it is. Whole operands are 100; a prefix expression,
+ * which runs to the end of what follows it, is 0.
+ */
+static int precedence(Node *node) {
+  switch (node->kind()) {
+    case kMulExpr:
+    case kDivExpr:
+      return 60;
+    case kPlusExpr:
+    case kMinusExpr:
+      return 50;
+    case kGreaterExpr:
+    case kGreaterEqualExpr:
+    case kLessExpr:
+    case kLessEqualExpr:
+    case kEqualEqualExpr:
+    case kNotEqualExpr:
+      return 30;
+    case kAndExpr:
+      return 20;
+    case kOrExpr:
+      return 10;
+    case kNotExpr:
+    case kIfExpr:
+      return 0;
+    default:
+      return 100;
+  }
+} /* precedence() */
+
+static bool is_infix(Node *node) {
+  int binding = precedence(node);
+  return binding > 0 && binding < 100;
+} /* is_infix() */
+
+/*
+ * Whether [expr] ends in an if or ! expression out of parentheses, which
+ * would take in whatever follows it in the text.
+ */
+static bool is_open(Node *expr) {
+  while (is_infix(expr)) {
+    expr = Child(expr, 1);
+  }
+  return expr->kind() == kIfExpr || expr->kind() == kNotExpr;
+} /* is_open() */
+
+/*
+ * Whether [expr] needs parentheses as a child of [parent], the left
+ * operand if [left], to mean the same in FCAL and in the C++ written for
+ * it. The C++ for ==, !=, && and || has no parentheses of its own, so they
+ * keep theirs; comparisons do not chain; and an operand that is open at
+ * its end is closed, as something may follow the operator it is under.
+ */
+static bool needs_group(Expr *expr, Node *parent, bool left) {
+  if (parent != NULL && parent->kind() == kGroupExpr) {
+    return false;
+  }
+  switch (expr->kind()) {
+    case kEqualEqualExpr:
+    case kNotEqualExpr:
+    case kAndExpr:
+    case kOrExpr:
+      return true;
+    default:
+      break;
+  }
+  if (parent == NULL || !is_infix(parent)) {
+    return false;
+  }
+  if (is_open(expr)) {
+    return true;
+  }
+  int inner = precedence(expr);
+  int outer = precedence(parent);
+  return inner < outer || (inner == outer && (!left || outer == 30));
+} /* needs_group() */
+
+static Expr *typed(Expr *expr, Type type) {
+  expr->set_type(type);
+  return expr;
+} /* typed() */
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+Node *Simplifier::Simplify(Node *root) {
+  return Walk(root);
+} /* Simplifier::Simplify() */
+
+Node *Simplifier::VisitIfExpr(IfExpr *node) {
+  bool test;
+  if (!boolean(node->expr_test(), &test)) {
+    return node;
+  }
+  return Reduce(node, test ? node->expr_then() : node->expr_else());
+} /* Simplifier::VisitIfExpr() */
+
+Node *Simplifier::VisitNotExpr(NotExpr *node) {
+  bool value;
+  if (boolean(node->expr(), &value)) {
+    return Boolean(!value);
+  }
+  if (node->expr()->kind() == kNotExpr) {
+    return Reduce(node, static_cast<NotExpr *>(node->expr())->expr());
+  }
+  return node;
+} /* Simplifier::VisitNotExpr() */
+
+/*
+ * Ints are computed as C++ computes them, in int, and floats in float:
+ * an int operand of a float operator is made a float first.
+ */
+Expr *Simplifier::Fold(char op, Expr *left, Expr *right) {
+  Number a, b;
+  if (!number(left, &a) || !number(right, &b)) {
+    return NULL;
+  }
+  if (!a.is_float && !b.is_float) {
+    long long result;  // NOLINT(runtime/int)
+    switch (op) {
+      case '+': result = a.int_value + b.int_value; break;
+      case '-': result = a.int_value - b.int_value; break;
+      case '*': result = a.int_value * b.int_value; break;
+      default:
+        if (b.int_value == 0) {
+          return NULL;
+        }
+        result = a.int_value / b.int_value;
+        break;
+    }
+    if (result < 0 || result > INT_MAX) {
+      return NULL;
+    }
+    return typed(arena_->New<IntConstExpr>(std::to_string(result)),
+                 kIntType);
+  }
+  float x = a.as_float();
+  float y = b.as_float();
+  float result;
+  switch (op) {
+    case '+': result = x + y; break;
+    case '-': result = x - y; break;
+    case '*': result = x * y; break;
+    default:
+      if (y == 0) {
+        return NULL;
+      }
+      result = x / y;
+      break;
+  }
+  std::string text;
+  if (!float_text(result, &text)) {
+    return NULL;
+  }
+  return typed(arena_->New<FloatConstExpr>(text), kFloatType);
+} /* Simplifier::Fold() */
+
+Expr *Simplifier::FoldCompare(NodeKind kind, Expr *left, Expr *right) {
+  Number a, b;
+  if (number(left, &a) && number(right, &b)) {
+    if (!a.is_float && !b.is_float) {
+      return Boolean(compare(kind, a.int_value, b.int_value));
+    }
+    return Boolean(compare(kind, a.as_float(), b.as_float()));
+  }
+  bool p, q;
+  if ((kind == kEqualEqualExpr || kind == kNotEqualExpr) &&
+      boolean(left, &p) && boolean(right, &q)) {
+    return Boolean(compare(kind, p, q));
+  }
+  return NULL;
+} /* Simplifier::FoldCompare() */
+
+/*
+ * Adding a float 0 is not dropped: -0.0 + 0 is 0.0, which C++ prints
+ * differently.
+ */
+Expr *Simplifier::Identity(Expr *node, char op, Expr *left, Expr *right) {
+  switch (op) {
+    case '+':
+      if (node->type() != kIntType) {
+        return NULL;
+      }
+      return is_number(right, 0) ? left : is_number(left, 0) ? right : NULL;
+    case '-':
+      return is_number(right, 0) ? left : NULL;
+    case '*':
+      return is_number(right, 1) ? left : is_number(left, 1) ? right : NULL;
+    default:
+      return is_number(right, 1) ? left : NULL;
+  }
+} /* Simplifier::Identity() */
+
+/*
+ * Only a constant left operand decides an && or an ||, which C++
+ * evaluates left to right.
+ */
+Expr *Simplifier::LogicOperand(bool unit, Expr *left, Expr *right) {
+  bool value;
+  if (boolean(left, &value)) {
+    return (value == unit) ? right : left;
+  }
+  if (boolean(right, &value) && value == unit) {
+    return left;
+  }
+  return NULL;
+} /* Simplifier::LogicOperand() */
+
+Node *Simplifier::Reduce(Expr *node, Expr *operand) {
+  if (operand == NULL || operand->type() != node->type() ||
+      node->type() == kNoType) {
+    return node;
+  }
+  return Place(node, operand);
+} /* Simplifier::Reduce() */
+
+Expr *Simplifier::Place(Expr *node, Expr *expr) {
+  Node *parent = this->parent();
+  bool left = parent != NULL && is_infix(parent) && Child(parent, 0) == node;
+  if (expr->kind() == kGroupExpr) {
+    Expr *inner = static_cast<GroupExpr *>(expr)->expr();
+    return needs_group(inner, parent, left) ? expr : inner;
+  }
+  if (needs_group(expr, parent, left)) {
+    return typed(arena_->New<GroupExpr>(expr), expr->type());
+  }
+  return expr;
+} /* Simplifier::Place() */
+
+Expr *Simplifier::Boolean(bool value) {
+  if (value) {
+    return typed(arena_->New<TrueExpr>(), kBoolType);
+  }
+  return typed(arena_->New<FalseExpr>(), kBoolType);
+} /* Simplifier::Boolean() */
+
+} /* namespace ast */
+} /* namespace fcal */
@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * Name            : skip.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : This file skips whitespace and comments between tokens,
+ *                   using SSE2 or AVX2 when the CPU has them.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/skip.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FCAL_SKIP_X86 1
+#include <immintrin.h>
+#endif
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/*
+ * The two searches the skipper is built from. skip_blanks returns the first
+ * byte in [p, end) that is not a space, tab, newline or carriage return;
+ * find_any returns the first byte equal to [a], [b] or [c]. Both return
+ * [end] when there is no such byte.
+ */
+struct SkipKernels {
+  const char *(*skip_blanks)(const char *p, const char *end);
+  const char *(*find_any)(const char *p, const char *end, char a, char b,
+                          char c);
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+static inline bool is_blank(char c) {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+static const char *skip_blanks_scalar(const char *p, const char *end) {
+  while (p < end && is_blank(*p)) {
+    p++;
+  }
+  return p;
+}
+
+static const char *find_any_scalar(const char *p, const char *end, char a,
+                                   char b, char c) {
+  while (p < end && *p != a && *p != b && *p != c) {
+    p++;
+  }
+  return p;
+}
+
+#ifdef FCAL_SKIP_X86
+/*
+ * The vector kernels compare a whole stride at once, turn the comparison into
+ * a bit mask with movemask, and find the first interesting byte with a count
+ * of trailing zeros. The tail that is shorter than a stride is left to the
+ * next narrower kernel, so no load ever reads past [end].
+ */
+__attribute__((target("sse2")))
+static const char *skip_blanks_sse2(const char *p, const char *end) {
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i newline = _mm_set1_epi8('\n');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i ret = _mm_set1_epi8('\r');
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i blank = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, newline)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, tab), _mm_cmpeq_epi8(v, ret)));
+    unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xffff;
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 16;
+  }
+  return skip_blanks_scalar(p, end);
+}
+
+__attribute__((target("sse2")))
+static const char *find_any_sse2(const char *p, const char *end, char a,
+                                 char b, char c) {
+  const __m128i va = _mm_set1_epi8(a);
+  const __m128i vb = _mm_set1_epi8(b);
+  const __m128i vc = _mm_set1_epi8(c);
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i hit = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)),
+        _mm_cmpeq_epi8(v, vc));
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 16;
+  }
+  return find_any_scalar(p, end, a, b, c);
+}
+
+__attribute__((target("avx2")))
+static const char *skip_blanks_avx2(const char *p, const char *end) {
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i newline = _mm256_set1_epi8('\n');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i ret = _mm256_set1_epi8('\r');
+  // Most gaps between tokens are short, so look at 16 bytes first.
+  if (end - p >= 16) {
+    const char *q = skip_blanks_sse2(p, p + 16);
+    if (q != p + 16) {
+      return q;
+    }
+    p = q;
+  }
+  while (end - p >= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i blank = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, space),
+                        _mm256_cmpeq_epi8(v, newline)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, tab),
+                        _mm256_cmpeq_epi8(v, ret)));
+    unsigned mask = ~static_cast<unsigned>(_mm256_movemask_epi8(blank));
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+  return skip_blanks_sse2(p, end);
+}
+
+__attribute__((target("avx2")))
+static const char *find_any_avx2(const char *p, const char *end, char a,
+                                 char b, char c) {
+  const __m256i va = _mm256_set1_epi8(a);
+  const __m256i vb = _mm256_set1_epi8(b);
+  const __m256i vc = _mm256_set1_epi8(c);
+  while (end - p >= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i hit = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)),
+        _mm256_cmpeq_epi8(v, vc));
+    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+  return find_any_sse2(p, end, a, b, c);
+}
+#endif /* FCAL_SKIP_X86 */
+
+static const SkipKernels kKernels[kNumSkipImpls] = {
+  { skip_blanks_scalar, find_any_scalar },
+#ifdef FCAL_SKIP_X86
+  { skip_blanks_sse2, find_any_sse2 },
+  { skip_blanks_avx2, find_any_avx2 },
+#else
+  { skip_blanks_scalar, find_any_scalar },
+  { skip_blanks_scalar, find_any_scalar },
+#endif
+};
+
+bool skip_impl_supported(SkipImpl impl) {
+  switch (impl) {
+    case kSkipScalar:
+      return true;
+#ifdef FCAL_SKIP_X86
+    case kSkipSse2:
+      return __builtin_cpu_supports("sse2");
+    case kSkipAvx2:
+      return __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  } /* switch() */
+} /* skip_impl_supported() */
+
+static SkipImpl select_skip_impl(void) {
+  if (skip_impl_supported(kSkipAvx2)) {
+    return kSkipAvx2;
+  }
+  if (skip_impl_supported(kSkipSse2)) {
+    return kSkipSse2;
+  }
+  return kSkipScalar;
+} /* select_skip_impl() */
+
+SkipImpl best_skip_impl(void) {
+  static const SkipImpl best = select_skip_impl();
+  return best;
+} /* best_skip_impl() */
+
+/*
+ * skip_with() - The skipper proper. Whitespace is a run of blanks; a block
+ * comment runs from "/" "*" to the first "*" "/" after it; a line comment
+ * runs from "//" through the next newline. No comment may contain a NUL, so
+ * the comment searches stop at NUL as well. Nor may a block comment contain
+ * a backslash: in kSkipPatterns it is written [^\*], and inside a POSIX
+ * bracket expression the backslash is literal, so that excludes it too.
+ */
+static size_t skip_with(const SkipKernels &k, const char *text,
+                        const char *end) {
+  const char *p = text;
+  for (;;) {
+    p = k.skip_blanks(p, end);
+    if (end - p < 2 || p[0] != '/') {
+      break;
+    }
+
+    const char *q = p + 2;
+    if (p[1] == '*') {
+      for (;;) {
+        q = k.find_any(q, end, '*', '\0', '\\');
+        if (q == end || *q != '*') {
+          return p - text;
+        }
+        if (end - q >= 2 && q[1] == '/') {
+          break;
+        }
+        q++;
+      }
+      p = q + 2;
+    } else if (p[1] == '/') {
+      q = k.find_any(q, end, '\n', '\0', '\n');
+      if (q == end || *q == '\0') {
+        break;
+      }
+      p = q + 1;
+    } else {
+      break;
+    }
+  } /* for() */
+  return p - text;
+} /* skip_with() */
+
+size_t skip_whitespace_and_comments(const char *text, const char *end,
+                                    SkipImpl impl) {
+  if (!skip_impl_supported(impl)) {
+    impl = kSkipScalar;
+  }
+  return skip_with(kKernels[impl], text, end);
+} /* skip_whitespace_and_comments() */
+
+size_t skip_whitespace_and_comments(const char *text, const char *end) {
+  static const SkipKernels &k = kKernels[best_skip_impl()];
+  return skip_with(k, text, end);
+} /* skip_whitespace_and_comments() */
+
+const char *find_any_byte(const char *p, const char *end, char a, char b,
+                          char c) {
+  static const SkipKernels &k = kKernels[best_skip_impl()];
+  return k.find_any(p, end, a, b, c);
+} /* find_any_byte() */
+
+} /* namespace scanner */
+} /* namespace fcal */
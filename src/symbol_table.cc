@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Name            : symbol_table.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file implements the table of interned identifiers.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string.h>
+#include "../include/symbol_table.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+const SymbolEntry Symbol::kEmptyEntry(kNoSymbol, 0, "", 0);
+
+/* Indexed by BuiltinSymbol. */
+static const char *kBuiltinNames[kNumBuiltinSymbols] = {
+  "n_rows",
+  "n_cols",
+  "matrix_read",
+};
+
+static const size_t kInitialSlots = 32;
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/* FNV-1a over the bytes of a name. */
+static unsigned hash_name(const char *text, size_t length) {
+  unsigned hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<unsigned char>(text[i])) * 16777619u;
+  }
+  return hash;
+}
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+SymbolTable::SymbolTable(Arena *arena)
+    : arena_(arena), entries_(NULL), size_(0), slots_(NULL), num_slots_(0) {
+  Grow();
+  for (int i = 0; i < kNumBuiltinSymbols; i++) {
+    Intern(kBuiltinNames[i], strlen(kBuiltinNames[i]));
+  }
+} /* SymbolTable::SymbolTable() */
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+Symbol SymbolTable::Intern(const char *text, size_t length) {
+  unsigned hash = hash_name(text, length);
+  size_t mask = num_slots_ - 1;
+  size_t slot = hash & mask;
+  for (; slots_[slot] != kNoSymbol; slot = (slot + 1) & mask) {
+    const SymbolEntry *entry = entries_[slots_[slot]];
+    if (entry->hash == hash && entry->text.size() == length &&
+        memcmp(entry->text.data(), text, length) == 0) {
+      return Symbol(entry);
+    }
+  }
+
+  int id = size_++;
+  entries_[id] = arena_->New<SymbolEntry>(id, hash, text, length);
+  slots_[slot] = id;
+  // Keep the table at most half full.
+  if (static_cast<size_t>(size_) * 2 == num_slots_) {
+    Grow();
+  }
+  return Symbol(entries_[id]);
+} /* SymbolTable::Intern() */
+
+/*
+ * Doubles the hash table, or makes the first one, and puts every entry
+ * back in it. The old arrays are left in the arena; they add up to less
+ * than the new ones.
+ */
+void SymbolTable::Grow(void) {
+  size_t num_slots = (num_slots_ == 0) ? kInitialSlots : num_slots_ * 2;
+  const SymbolEntry **entries = static_cast<const SymbolEntry **>(
+      arena_->Allocate(num_slots / 2 * sizeof(*entries), alignof(void *)));
+  for (int i = 0; i < size_; i++) {
+    entries[i] = entries_[i];
+  }
+  slots_ = static_cast<int *>(
+      arena_->Allocate(num_slots * sizeof(*slots_), alignof(int)));
+  num_slots_ = num_slots;
+  entries_ = entries;
+
+  size_t mask = num_slots_ - 1;
+  for (size_t i = 0; i < num_slots_; i++) {
+    slots_[i] = kNoSymbol;
+  }
+  for (int i = 0; i < size_; i++) {
+    size_t slot = entries_[i]->hash & mask;
+    while (slots_[slot] != kNoSymbol) {
+      slot = (slot + 1) & mask;
+    }
+    slots_[slot] = i;
+  }
+} /* SymbolTable::Grow() */
+
+} /* namespace ast */
+} /* namespace fcal */
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Name            : thread_pool.cc
+ * Project         : fcal
+ * Module          : util
+ * Description     : This file implements a fixed-size pool of worker threads.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <utility>
+#include "../include/thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+
+/*******************************************************************************
+ * Constant Definitions
+ ******************************************************************************/
+/* The pool and worker number of the calling thread, if it is a worker. */
+static thread_local const ThreadPool *current_pool = NULL;
+static thread_local int current_index = -1;
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+ThreadPool::ThreadPool(int num_threads)
+    : workers_(), queues_(), next_queue_(0), queued_(0), mutex_(),
+      work_ready_(), work_done_(), pending_(0), stopping_(false) {
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  if (num_threads <= 0) {
+    num_threads = 1;
+  }
+  for (int i = 0; i < num_threads; i++) {
+    queues_.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+  }
+  for (int i = 0; i < num_threads; i++) {
+    workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+  }
+} /* ThreadPool::ThreadPool() */
+
+ThreadPool::~ThreadPool(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_ready_.notify_all();
+  for (size_t i = 0; i < workers_.size(); i++) {
+    workers_[i].join();
+  }
+} /* ThreadPool::~ThreadPool() */
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+int ThreadPool::worker_index(void) const {
+  return (current_pool == this) ? current_index : -1;
+} /* ThreadPool::worker_index() */
+
+void ThreadPool::Submit(std::function<void()> task) {
+  int index = worker_index();
+  if (index < 0) {
+    index = static_cast<int>(next_queue_++ % queues_.size());
+  }
+  {
+    // pending_ goes up before the task can be taken, so that it cannot
+    // drop to 0 while this task is still to run.
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_++;
+    std::lock_guard<std::mutex> queue_lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+    queued_++;
+  }
+  work_ready_.notify_one();
+} /* ThreadPool::Submit() */
+
+void ThreadPool::Wait(void) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (pending_ > 0) {
+    work_done_.wait(lock);
+  }
+} /* ThreadPool::Wait() */
+
+/*
+ * Takes the newest task on worker [index]'s own queue or, failing that, the
+ * oldest on one of the others', starting with the next worker's. Returns
+ * false if every queue was empty.
+ */
+bool ThreadPool::TakeTask(int index, std::function<void()> *task) {
+  int n = static_cast<int>(queues_.size());
+  for (int i = 0; i < n; i++) {
+    WorkQueue *queue = queues_[(index + i) % n].get();
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->tasks.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      *task = std::move(queue->tasks.back());
+      queue->tasks.pop_back();
+    } else {
+      *task = std::move(queue->tasks.front());
+      queue->tasks.pop_front();
+    }
+    queued_--;
+    return true;
+  }
+  return false;
+} /* ThreadPool::TakeTask() */
+
+void ThreadPool::WorkerLoop(int index) {
+  current_pool = this;
+  current_index = index;
+  for (;;) {
+    std::function<void()> task;
+    if (!TakeTask(index, &task)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (queued_ == 0 && !stopping_) {
+        work_ready_.wait(lock);
+      }
+      if (queued_ == 0) {
+        return;
+      }
+      continue;
+    }
+
+    task();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--pending_ == 0) {
+      work_done_.notify_all();
+    }
+  } /* for() */
+} /* ThreadPool::WorkerLoop() */
+
+} /* namespace fcal */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Name            : token_specs.cc
+ * Project         : fcal
+ * Module          : scanner
+ * Description     : The regular expressions for every terminal and for the
+ *                   whitespace and comments between them. The scanner's DFA
+ *                   tables are generated from these at build time.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/scanner.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace scanner {
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+/*The regular expression for every terminal, in kTokenEnumType order*/
+const TokenSpec kTokenSpecs[] = {
+    // Keywords
+    { kIntKwd, "^int" },
+    { kFloatKwd, "^float" },
+    { kBoolKwd, "^boolean" },
+    { kTrueKwd, "^True" },
+    { kFalseKwd, "^False" },
+    { kStringKwd, "^string" },
+    { kMatrixKwd, "^matrix" },
+    { kLetKwd, "^let" },
+    { kInKwd, "^in" },
+    { kEndKwd, "^end" },
+    { kIfKwd, "^if" },
+    { kThenKwd, "^then" },
+    { kElseKwd, "^else" },
+    { kRepeatKwd, "^repeat" },
+    { kWhileKwd, "^while" },
+    { kPrintKwd, "^print" },
+    { kToKwd, "^to" },
+
+    // Constants
+    { kIntConst, "^[0-9]+" },
+    { kFloatConst, "^[0-9]*\\.[0-9]+" },
+    { kStringConst, "^\"[^\"]*\"" },
+
+    // Variable Name
+    { kVariableName, "^_*[a-zA-Z]+[_a-zA-Z0-9-]*" },
+
+    // Punctuation
+    { kLeftParen, "^\\(" },
+    { kRightParen, "^\\)" },
+    { kLeftCurly, "^\\{" },
+    { kRightCurly, "^\\}" },
+    { kLeftSquare, "^\\[" },
+    { kRightSquare, "^\\]" },
+    { kSemiColon, "^;" },
+    { kColon, "^:" },
+
+    // Operations
+    { kAssign, "^=" },
+    { kPlusSign, "^\\+" },
+    { kStar, "^\\*" },
+    { kDash, "^-" },
+    { kForwardSlash, "^/" },
+    { kLessThan, "^<" },
+    { kLessThanEqual, "^<=" },
+    { kGreaterThan, "^>" },
+    { kGreaterThanEqual, "^>=" },
+    { kEqualsEquals, "^==" },
+    { kNotEquals, "^!=" },
+    { kAndOp, "^&&" },
+    { kOrOp, "^\\|\\|" },
+    { kNotOp, "^!" }
+};
+const int kNumTokenSpecs = sizeof(kTokenSpecs) / sizeof(kTokenSpecs[0]);
+
+/*Whitespace, block comments and line comments, skipped between tokens*/
+const char *const kSkipPatterns[] = {
+    "^[\n\t\r ]+",
+    "^/\\*([^\\*]|\\*+[^\\*/])*\\*+/",
+    "^//[^\n]*\n"
+};
+const int kNumSkipPatterns = sizeof(kSkipPatterns) / sizeof(kSkipPatterns[0]);
+
+} /* namespace scanner */
+} /* namespace fcal */
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * Name            : type_checker.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file implements the pass that finds the type of
+ *                   every expression of an AST.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/type_checker.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+const char *TypeName(Type type) {
+  switch (type) {
+    case kIntType: return "int";
+    case kFloatType: return "float";
+    case kBoolType: return "boolean";
+    case kStringType: return "string";
+    case kMatrixType: return "matrix";
+    default: return "<error>";
+  }
+} /* TypeName() */
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void TypeChecker::Check(Node *root) {
+  types_.Clear();
+  errors_.clear();
+  Walk(root);
+} /* TypeChecker::Check() */
+
+/*
+ * The names a scope declares before its body are declared here, so that
+ * the body sees them; each scope is closed when its node is visited.
+ */
+bool TypeChecker::Enter(Node *node) {
+  switch (node->kind()) {
+    case kBlockStmt:
+    case kLetExpr:
+      OpenScope();
+      break;
+    case kLongMatrixDecl: {
+      LongMatrixDecl *decl = static_cast<LongMatrixDecl *>(node);
+      OpenScope();
+      Declare(decl->name_left(), kIntType);
+      Declare(decl->name_right(), kIntType);
+      break;
+    }
+    default:
+      break;
+  }
+  return true;
+} /* TypeChecker::Enter() */
+
+Node *TypeChecker::VisitVarExpr(VarExpr *node) {
+  Type type = Lookup(node->name());
+  if (type == kNoType) {
+    Error(node->name().str() + " is not declared");
+  }
+  return Typed(node, type);
+} /* TypeChecker::VisitVarExpr() */
+
+Node *TypeChecker::VisitMulExpr(MulExpr *node) {
+  Type left = node->expr_left()->type();
+  Type right = node->expr_right()->type();
+  if (left == kMatrixType && right == kMatrixType) {
+    return Typed(node, kMatrixType);
+  }
+  return Typed(node, ArithmeticType(left, "*", right));
+} /* TypeChecker::VisitMulExpr() */
+
+Node *TypeChecker::VisitMatrixRefExpr(MatrixRefExpr *node) {
+  Type matrix = Lookup(node->name());
+  ExpectType(matrix, kMatrixType, node->name().str() + " is not a matrix");
+  ExpectType(node->expr_left()->type(), kIntType, "row index is not an int");
+  ExpectType(node->expr_right()->type(), kIntType,
+             "column index is not an int");
+  return Typed(node, (matrix == kMatrixType) ? kFloatType : kNoType);
+} /* TypeChecker::VisitMatrixRefExpr() */
+
+Node *TypeChecker::VisitFuncCallExpr(FuncCallExpr *node) {
+  Type argument = node->expr()->type();
+  switch (node->name().id()) {
+    case kNRowsSymbol:
+    case kNColsSymbol:
+      ExpectType(argument, kMatrixType,
+                 node->name().str() + " takes a matrix");
+      return Typed(node, (argument == kMatrixType) ? kIntType : kNoType);
+    case kMatrixReadSymbol:
+      ExpectType(argument, kStringType, "matrix_read takes a string");
+      return Typed(node, (argument == kStringType) ? kMatrixType : kNoType);
+    default:
+      Error(node->name().str() + " is not a function");
+      return Typed(node, kNoType);
+  }
+} /* TypeChecker::VisitFuncCallExpr() */
+
+Node *TypeChecker::VisitIfExpr(IfExpr *node) {
+  ExpectType(node->expr_test()->type(), kBoolType,
+             "if expression's condition is not a boolean");
+  Type then_type = node->expr_then()->type();
+  Type else_type = node->expr_else()->type();
+  Type type = Unify(then_type, else_type);
+  if (type == kNoType && then_type != kNoType && else_type != kNoType) {
+    Error(std::string("if expression's branches are ") +
+          TypeName(then_type) + " and " + TypeName(else_type));
+  }
+  return Typed(node, type);
+} /* TypeChecker::VisitIfExpr() */
+
+Node *TypeChecker::VisitNotExpr(NotExpr *node) {
+  Type type = node->expr()->type();
+  ExpectType(type, kBoolType, "! takes a boolean");
+  return Typed(node, (type == kBoolType) ? kBoolType : kNoType);
+} /* TypeChecker::VisitNotExpr() */
+
+Node *TypeChecker::VisitLetExpr(LetExpr *node) {
+  CloseScope();
+  return Typed(node, node->expr()->type());
+} /* TypeChecker::VisitLetExpr() */
+
+Node *TypeChecker::VisitIntDecl(IntDecl *node) {
+  Declare(node->name(), kIntType);
+  return node;
+} /* TypeChecker::VisitIntDecl() */
+
+Node *TypeChecker::VisitFloatDecl(FloatDecl *node) {
+  Declare(node->name(), kFloatType);
+  return node;
+} /* TypeChecker::VisitFloatDecl() */
+
+Node *TypeChecker::VisitStringDecl(StringDecl *node) {
+  Declare(node->name(), kStringType);
+  return node;
+} /* TypeChecker::VisitStringDecl() */
+
+Node *TypeChecker::VisitBooleanDecl(BooleanDecl *node) {
+  Declare(node->name(), kBoolType);
+  return node;
+} /* TypeChecker::VisitBooleanDecl() */
+
+Node *TypeChecker::VisitShortMatrixDecl(ShortMatrixDecl *node) {
+  ExpectType(node->expr()->type(), kMatrixType,
+             node->name().str() + " is not given a matrix");
+  Declare(node->name(), kMatrixType);
+  return node;
+} /* TypeChecker::VisitShortMatrixDecl() */
+
+Node *TypeChecker::VisitLongMatrixDecl(LongMatrixDecl *node) {
+  CloseScope();
+  ExpectType(node->expr_left()->type(), kIntType,
+             node->name().str() + "'s number of rows is not an int");
+  ExpectType(node->expr_right()->type(), kIntType,
+             node->name().str() + "'s number of columns is not an int");
+  Type element = node->expr()->type();
+  if (element != kNoType && !IsNumber(element)) {
+    Error(node->name().str() + "'s elements are not numbers");
+  }
+  Declare(node->name(), kMatrixType);
+  return node;
+} /* TypeChecker::VisitLongMatrixDecl() */
+
+Node *TypeChecker::VisitBlockStmt(BlockStmt *node) {
+  CloseScope();
+  return node;
+} /* TypeChecker::VisitBlockStmt() */
+
+Node *TypeChecker::VisitIfStmt(IfStmt *node) {
+  ExpectType(node->expr()->type(), kBoolType,
+             "if statement's condition is not a boolean");
+  return node;
+} /* TypeChecker::VisitIfStmt() */
+
+Node *TypeChecker::VisitIfElseStmt(IfElseStmt *node) {
+  ExpectType(node->expr()->type(), kBoolType,
+             "if statement's condition is not a boolean");
+  return node;
+} /* TypeChecker::VisitIfElseStmt() */
+
+/* Ints and floats can be assigned to one another, as in C++. */
+Node *TypeChecker::VisitAssignStmt(AssignStmt *node) {
+  Type variable = Lookup(node->name());
+  Type value = node->expr()->type();
+  if (variable == kNoType) {
+    Error(node->name().str() + " is not declared");
+  } else if (value != kNoType && value != variable &&
+             !(IsNumber(value) && IsNumber(variable))) {
+    Error(std::string(TypeName(value)) + " assigned to " +
+          node->name().str() + ", a " + TypeName(variable));
+  }
+  return node;
+} /* TypeChecker::VisitAssignStmt() */
+
+Node *TypeChecker::VisitMatrixAssignStmt(MatrixAssignStmt *node) {
+  ExpectType(Lookup(node->name()), kMatrixType,
+             node->name().str() + " is not a matrix");
+  ExpectType(node->expr_left()->type(), kIntType, "row index is not an int");
+  ExpectType(node->expr_right()->type(), kIntType,
+             "column index is not an int");
+  Type value = node->expr_result()->type();
+  if (value != kNoType && !IsNumber(value)) {
+    Error(std::string(TypeName(value)) + " assigned to an element of " +
+          node->name().str());
+  }
+  return node;
+} /* TypeChecker::VisitMatrixAssignStmt() */
+
+Node *TypeChecker::VisitRepeatStmt(RepeatStmt *node) {
+  ExpectType(Lookup(node->name()), kIntType,
+             "repeat variable " + node->name().str() + " is not an int");
+  ExpectType(node->expr_lower()->type(), kIntType,
+             "repeat's lower bound is not an int");
+  ExpectType(node->expr_upper()->type(), kIntType,
+             "repeat's upper bound is not an int");
+  return node;
+} /* TypeChecker::VisitRepeatStmt() */
+
+Node *TypeChecker::VisitWhileStmt(WhileStmt *node) {
+  ExpectType(node->expr()->type(), kBoolType,
+             "while statement's condition is not a boolean");
+  return node;
+} /* TypeChecker::VisitWhileStmt() */
+
+Type TypeChecker::Unify(Type left, Type right) {
+  if (left == right) {
+    return left;
+  }
+  if (IsNumber(left) && IsNumber(right)) {
+    return kFloatType;
+  }
+  return kNoType;
+} /* TypeChecker::Unify() */
+
+Type TypeChecker::ArithmeticType(Type left, const char *op, Type right) {
+  bool ok = Expect(IsNumber(left) && IsNumber(right), left, op, right);
+  return ok ? Unify(left, right) : kNoType;
+} /* TypeChecker::ArithmeticType() */
+
+bool TypeChecker::Expect(bool ok, Type left, const char *op, Type right) {
+  if (!ok && left != kNoType && right != kNoType) {
+    Error(std::string(op) + " does not apply to " + TypeName(left) +
+          " and " + TypeName(right));
+  }
+  return ok;
+} /* TypeChecker::Expect() */
+
+void TypeChecker::ExpectType(Type type, Type expected,
+                             const std::string &what) {
+  if (type != expected && type != kNoType) {
+    Error(what);
+  }
+} /* TypeChecker::ExpectType() */
+
+} /* namespace ast */
+} /* namespace fcal */
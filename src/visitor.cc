@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * Name            : visitor.cc
+ * Project         : fcal
+ * Module          : ast
+ * Description     : This file lists the children of each kind of AST node
+ *                   for the visitors and walkers.
+ * Copyright       : 2017 CSCI3081W Staff. All rights reserved.
+ * Original Author : Son Nguyen
+ * Modifications by: Son Nguyen, Yu Fang
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../include/visitor.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+namespace fcal {
+namespace ast {
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+/* Stores the children given in [children] and returns how many there are. */
+static size_t store(Node **children, Node *a) {
+  children[0] = a;
+  return 1;
+} /* store() */
+
+static size_t store(Node **children, Node *a, Node *b) {
+  children[0] = a;
+  children[1] = b;
+  return 2;
+} /* store() */
+
+static size_t store(Node **children, Node *a, Node *b, Node *c) {
+  children[0] = a;
+  children[1] = b;
+  children[2] = c;
+  return 3;
+} /* store() */
+
+template <typename N>
+static size_t store_binary(Node *node, Node **children) {
+  N *n = static_cast<N *>(node);
+  return store(children, n->expr_left(), n->expr_right());
+} /* store_binary() */
+
+size_t Children(Node *node, Node **children) {
+  switch (node->kind()) {
+    case kMulExpr: return store_binary<MulExpr>(node, children);
+    case kDivExpr: return store_binary<DivExpr>(node, children);
+    case kPlusExpr: return store_binary<PlusExpr>(node, children);
+    case kMinusExpr: return store_binary<MinusExpr>(node, children);
+    case kGreaterExpr: return store_binary<GreaterExpr>(node, children);
+    case kGreaterEqualExpr:
+      return store_binary<GreaterEqualExpr>(node, children);
+    case kLessExpr: return store_binary<LessExpr>(node, children);
+    case kLessEqualExpr: return store_binary<LessEqualExpr>(node, children);
+    case kEqualEqualExpr: return store_binary<EqualEqualExpr>(node, children);
+    case kNotEqualExpr: return store_binary<NotEqualExpr>(node, children);
+    case kAndExpr: return store_binary<AndExpr>(node, children);
+    case kOrExpr: return store_binary<OrExpr>(node, children);
+    case kMatrixRefExpr: return store_binary<MatrixRefExpr>(node, children);
+    case kFuncCallExpr:
+      return store(children, static_cast<FuncCallExpr *>(node)->expr());
+    case kGroupExpr:
+      return store(children, static_cast<GroupExpr *>(node)->expr());
+    case kNotExpr:
+      return store(children, static_cast<NotExpr *>(node)->expr());
+    case kIfExpr: {
+      IfExpr *n = static_cast<IfExpr *>(node);
+      return store(children, n->expr_test(), n->expr_then(), n->expr_else());
+    }
+    case kLetExpr: {
+      LetExpr *n = static_cast<LetExpr *>(node);
+      return store(children, n->stmts(), n->expr());
+    }
+    case kShortMatrixDecl:
+      return store(children, static_cast<ShortMatrixDecl *>(node)->expr());
+    case kLongMatrixDecl: {
+      LongMatrixDecl *n = static_cast<LongMatrixDecl *>(node);
+      return store(children, n->expr_left(), n->expr_right(), n->expr());
+    }
+    case kStmts:
+      return static_cast<Stmts *>(node)->size();
+    case kDeclStmt:
+      return store(children, static_cast<DeclStmt *>(node)->decl());
+    case kBlockStmt:
+      return store(children, static_cast<BlockStmt *>(node)->stmts());
+    case kIfStmt: {
+      IfStmt *n = static_cast<IfStmt *>(node);
+      return store(children, n->expr(), n->stmt());
+    }
+    case kIfElseStmt: {
+      IfElseStmt *n = static_cast<IfElseStmt *>(node);
+      return store(children, n->expr(), n->then_stmt(), n->else_stmt());
+    }
+    case kAssignStmt:
+      return store(children, static_cast<AssignStmt *>(node)->expr());
+    case kMatrixAssignStmt: {
+      MatrixAssignStmt *n = static_cast<MatrixAssignStmt *>(node);
+      return store(children, n->expr_left(), n->expr_right(),
+                   n->expr_result());
+    }
+    case kPrintStmt:
+      return store(children, static_cast<PrintStmt *>(node)->expr());
+    case kRepeatStmt: {
+      RepeatStmt *n = static_cast<RepeatStmt *>(node);
+      return store(children, n->expr_lower(), n->expr_upper(), n->stmt());
+    }
+    case kWhileStmt: {
+      WhileStmt *n = static_cast<WhileStmt *>(node);
+      return store(children, n->expr(), n->stmt());
+    }
+    case kProgram:
+      return store(children, static_cast<Program *>(node)->stmts());
+    default:
+      return 0;
+  }
+} /* Children() */
+
+size_t NumChildren(Node *node) {
+  Node *children[kMaxChildren];
+  return Children(node, children);
+} /* NumChildren() */
+
+Node *Child(Node *node, size_t i) {
+  if (node->kind() == kStmts) {
+    return static_cast<Stmts *>(node)->stmt(i);
+  }
+  Node *children[kMaxChildren];
+  Children(node, children);
+  return children[i];
+} /* Child() */
+
+static Expr *as_expr(Node *node) { return static_cast<Expr *>(node); }
+static Stmt *as_stmt(Node *node) { return static_cast<Stmt *>(node); }
+static Stmts *as_stmts(Node *node) { return static_cast<Stmts *>(node); }
+
+template <typename N>
+static void set_binary(Node *node, size_t i, Node *child) {
+  N *n = static_cast<N *>(node);
+  if (i == 0) {
+    n->set_expr_left(as_expr(child));
+  } else {
+    n->set_expr_right(as_expr(child));
+  }
+} /* set_binary() */
+
+void SetChild(Node *node, size_t i, Node *child) {
+  switch (node->kind()) {
+    case kMulExpr: set_binary<MulExpr>(node, i, child); break;
+    case kDivExpr: set_binary<DivExpr>(node, i, child); break;
+    case kPlusExpr: set_binary<PlusExpr>(node, i, child); break;
+    case kMinusExpr: set_binary<MinusExpr>(node, i, child); break;
+    case kGreaterExpr: set_binary<GreaterExpr>(node, i, child); break;
+    case kGreaterEqualExpr:
+      set_binary<GreaterEqualExpr>(node, i, child);
+      break;
+    case kLessExpr: set_binary<LessExpr>(node, i, child); break;
+    case kLessEqualExpr: set_binary<LessEqualExpr>(node, i, child); break;
+    case kEqualEqualExpr: set_binary<EqualEqualExpr>(node, i, child); break;
+    case kNotEqualExpr: set_binary<NotEqualExpr>(node, i, child); break;
+    case kAndExpr: set_binary<AndExpr>(node, i, child); break;
+    case kOrExpr: set_binary<OrExpr>(node, i, child); break;
+    case kMatrixRefExpr: set_binary<MatrixRefExpr>(node, i, child); break;
+    case kFuncCallExpr:
+      static_cast<FuncCallExpr *>(node)->set_expr(as_expr(child));
+      break;
+    case kGroupExpr:
+      static_cast<GroupExpr *>(node)->set_expr(as_expr(child));
+      break;
+    case kNotExpr:
+      static_cast<NotExpr *>(node)->set_expr(as_expr(child));
+      break;
+    case kIfExpr: {
+      IfExpr *n = static_cast<IfExpr *>(node);
+      if (i == 0) {
+        n->set_expr_test(as_expr(child));
+      } else if (i == 1) {
+        n->set_expr_then(as_expr(child));
+      } else {
+        n->set_expr_else(as_expr(child));
+      }
+      break;
+    }
+    case kLetExpr: {
+      LetExpr *n = static_cast<LetExpr *>(node);
+      if (i == 0) {
+        n->set_stmts(as_stmts(child));
+      } else {
+        n->set_expr(as_expr(child));
+      }
+      break;
+    }
+    case kShortMatrixDecl:
+      static_cast<ShortMatrixDecl *>(node)->set_expr(as_expr(child));
+      break;
+    case kLongMatrixDecl:
+      if (i < 2) {
+        set_binary<LongMatrixDecl>(node, i, child);
+      } else {
+        static_cast<LongMatrixDecl *>(node)->set_expr(as_expr(child));
+      }
+      break;
+    case kStmts:
+      static_cast<Stmts *>(node)->set_stmt(i, as_stmt(child));
+      break;
+    case kDeclStmt:
+      static_cast<DeclStmt *>(node)->set_decl(static_cast<Decl *>(child));
+      break;
+    case kBlockStmt:
+      static_cast<BlockStmt *>(node)->set_stmts(as_stmts(child));
+      break;
+    case kIfStmt: {
+      IfStmt *n = static_cast<IfStmt *>(node);
+      if (i == 0) {
+        n->set_expr(as_expr(child));
+      } else {
+        n->set_stmt(as_stmt(child));
+      }
+      break;
+    }
+    case kIfElseStmt: {
+      IfElseStmt *n = static_cast<IfElseStmt *>(node);
+      if (i == 0) {
+        n->set_expr(as_expr(child));
+      } else if (i == 1) {
+        n->set_then_stmt(as_stmt(child));
+      } else {
+        n->set_else_stmt(as_stmt(child));
+      }
+      break;
+    }
+    case kAssignStmt:
+      static_cast<AssignStmt *>(node)->set_expr(as_expr(child));
+      break;
+    case kMatrixAssignStmt:
+      if (i < 2) {
+        set_binary<MatrixAssignStmt>(node, i, child);
+      } else {
+        static_cast<MatrixAssignStmt *>(node)->set_expr_result(
+            as_expr(child));
+      }
+      break;
+    case kPrintStmt:
+      static_cast<PrintStmt *>(node)->set_expr(as_expr(child));
+      break;
+    case kRepeatStmt: {
+      RepeatStmt *n = static_cast<RepeatStmt *>(node);
+      if (i == 0) {
+        n->set_expr_lower(as_expr(child));
+      } else if (i == 1) {
+        n->set_expr_upper(as_expr(child));
+      } else {
+        n->set_stmt(as_stmt(child));
+      }
+      break;
+    }
+    case kWhileStmt: {
+      WhileStmt *n = static_cast<WhileStmt *>(node);
+      if (i == 0) {
+        n->set_expr(as_expr(child));
+      } else {
+        n->set_stmt(as_stmt(child));
+      }
+      break;
+    }
+    case kProgram:
+      static_cast<Program *>(node)->set_stmts(as_stmts(child));
+      break;
+    default:
+      break;
+  }
+} /* SetChild() */
+
+} /* namespace ast */
+} /* namespace fcal */
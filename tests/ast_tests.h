@@ -20,9 +20,14 @@
 
 #include <cxxtest/TestSuite.h>
 #include <iostream>
+#include "include/dead_code.h"
 #include "include/parser.h"
 #include "include/read_input.h"
+#include "include/simplifier.h"
+#include "include/type_checker.h"
+#include "include/visitor.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <fstream>
@@ -33,6 +38,24 @@ using namespace parser;
 using namespace ast;
 using namespace scanner;
 
+// Counts the nodes of each kind, and how many expressions there are.
+class NodeCounter : public Walker<NodeCounter> {
+public:
+    NodeCounter() : exprs(0) { for (auto &c : counts) c = 0; }
+    Node *VisitExpr(Expr *e) { exprs++; return VisitNode(e); }
+    Node *VisitNode(Node *n) { counts[n->kind()]++; return n; }
+    size_t counts[kNumNodeKinds];
+    size_t exprs;
+};
+
+// Drops the parentheses around every expression, except inside the
+// statements that Enter() tells it to skip.
+class GroupDropper : public Walker<GroupDropper> {
+public:
+    bool Enter(Node *n) { return n->kind() != kPrintStmt; }
+    Node *VisitGroupExpr(GroupExpr *e) { return e->expr(); }
+};
+
 class AstTestSuite : public CxxTest::TestSuite
 {
 public:
@@ -84,6 +107,301 @@ public:
         TSM_ASSERT_EQUALS(file + " unparse-2 != unparse-3.", up2, up3) ;
     }
 
+    void test_symbol_table_interns(void) {
+        Arena arena;
+        SymbolTable symbols(&arena);
+        TS_ASSERT_EQUALS(symbols.size(), kNumBuiltinSymbols);
+        TS_ASSERT_EQUALS(symbols.Intern("n_cols").id(), kNColsSymbol);
+
+        Symbol x = symbols.Intern("x");
+        TS_ASSERT(x == symbols.Intern("xy", 1));
+        TS_ASSERT(x != symbols.Intern("y"));
+        TS_ASSERT_EQUALS(x.str(), "x");
+        TS_ASSERT(Symbol().empty());
+        TS_ASSERT_EQUALS(Symbol().id(), kNoSymbol);
+
+        // Enough names to make the table grow a few times.
+        for (int i = 0; i < 5000; i++) {
+            symbols.Intern("v" + to_string(i));
+        }
+        TS_ASSERT_EQUALS(symbols.size(), kNumBuiltinSymbols + 5002);
+        TS_ASSERT(symbols.Intern("v1234") == symbols.symbol(x.id() + 1236));
+        TS_ASSERT(symbols.Intern("x") == x);
+    }
+
+    void test_parse_interns_names(void) {
+        ParseResult pr = p.Parse(
+            "main () { matrix m = matrix_read(\"m.data\"); int n; "
+            "n = n_rows(m); n = n_cols(m) + n; }");
+        TS_ASSERT(pr.ok());
+        SymbolTable *symbols = pr.symbols();
+        TS_ASSERT(symbols != NULL);
+        // The builtins, then main, m and n, each once.
+        TS_ASSERT_EQUALS(symbols->size(), kNumBuiltinSymbols + 3);
+
+        string cpp = pr.ast()->CppCode();
+        TS_ASSERT(cpp.find("matrix::matrix_read(\"m.data\")") != string::npos);
+        TS_ASSERT(cpp.find("n = m.n_rows();") != string::npos);
+        TS_ASSERT(cpp.find("n = (m.n_cols() + n);") != string::npos);
+    }
+
+    void test_emit_to_file(void) {
+        string text = "main () {\n";
+        for (int i = 0; i < 5000; i++) {
+            text += "x = (x + " + to_string(i) + ") * 2;\n";
+        }
+        ParseResult pr = p.Parse((text + "}").c_str());
+        TS_ASSERT(pr.ok());
+
+        FILE *file = tmpfile();
+        TS_ASSERT(file != NULL);
+        {
+            Emitter out(fileno(file));
+            out.Emit(pr.ast(), kCpp);
+            TS_ASSERT(out.Flush());
+        }
+        string cpp = pr.ast()->CppCode();
+        TS_ASSERT(cpp.size() > kEmitBufferSize);
+        string written(cpp.size() + 1, '\0');
+        rewind(file);
+        written.resize(fread(&written[0], 1, written.size(), file));
+        fclose(file);
+        TS_ASSERT_EQUALS(written, cpp);
+    }
+
+    void test_emit_deep_expression(void) {
+        const size_t kDepth = 100000;
+        string expr = string(kDepth, '(') + "x" + string(kDepth, ')');
+        ParseResult pr = p.Parse(("main () { x = " + expr + "; }").c_str());
+        TS_ASSERT(pr.ok());
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                         "main() {\nx = " + expr + ";\n}");
+        TS_ASSERT(pr.ast()->CppCode().find("x = " + expr + ";\n") !=
+                  string::npos);
+    }
+
+    void test_walker_counts_nodes(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; n = (1 + n) * 2; if (n > 1) print(n); }");
+        TS_ASSERT(pr.ok());
+        NodeCounter counter;
+        TS_ASSERT_EQUALS(counter.Walk(pr.ast()), pr.ast());
+        TS_ASSERT_EQUALS(counter.counts[kProgram], 1u);
+        TS_ASSERT_EQUALS(counter.counts[kVarExpr], 3u);
+        TS_ASSERT_EQUALS(counter.counts[kIntConstExpr], 3u);
+        TS_ASSERT_EQUALS(counter.counts[kIntDecl], 1u);
+        TS_ASSERT_EQUALS(counter.exprs, 10u);
+    }
+
+    void test_walker_rewrites(void) {
+        ParseResult pr = p.Parse(
+            "main () { n = ((1 + n)) * (2); print((n)); }");
+        TS_ASSERT(pr.ok());
+        GroupDropper dropper;
+        TS_ASSERT_EQUALS(dropper.Walk(pr.ast()), pr.ast());
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                         "main() {\nn = 1 + n * 2;\nprint ((n));}");
+    }
+
+    void test_walk_deep_expression(void) {
+        const size_t kDepth = 100000;
+        string expr = string(kDepth, '(') + "x" + string(kDepth, ')');
+        ParseResult pr = p.Parse(("main () { x = " + expr + "; }").c_str());
+        TS_ASSERT(pr.ok());
+        NodeCounter counter;
+        counter.Walk(pr.ast());
+        TS_ASSERT_EQUALS(counter.counts[kGroupExpr], kDepth);
+        GroupDropper dropper;
+        dropper.Walk(pr.ast());
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(), "main() {\nx = x;\n}");
+    }
+
+    void test_type_checker_types_exprs(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; float f; boolean b; "
+            "matrix p = matrix_read(\"p\"); matrix q = p * p; f = n * 1.5; b = !(f < n); "
+            "n = n_rows(q) + let int k; in k end; f = q[n : 0]; }");
+        TS_ASSERT(pr.ok());
+        TypeChecker checker;
+        checker.Check(pr.ast());
+        TS_ASSERT(checker.errors().empty());
+
+        Stmts *stmts = static_cast<Program *>(pr.ast())->stmts();
+        ShortMatrixDecl *q = static_cast<ShortMatrixDecl *>(
+            static_cast<DeclStmt *>(stmts->stmt(4))->decl());
+        TS_ASSERT_EQUALS(q->expr()->type(), kMatrixType);
+        AssignStmt *f = static_cast<AssignStmt *>(stmts->stmt(5));
+        TS_ASSERT_EQUALS(f->expr()->type(), kFloatType);
+        AssignStmt *b = static_cast<AssignStmt *>(stmts->stmt(6));
+        TS_ASSERT_EQUALS(b->expr()->type(), kBoolType);
+        AssignStmt *n = static_cast<AssignStmt *>(stmts->stmt(7));
+        TS_ASSERT_EQUALS(n->expr()->type(), kIntType);
+        AssignStmt *ref = static_cast<AssignStmt *>(stmts->stmt(8));
+        TS_ASSERT_EQUALS(ref->expr()->type(), kFloatType);
+
+        string cpp = pr.ast()->CppCode();
+        TS_ASSERT(cpp.find("bool b;") != string::npos);
+        TS_ASSERT(cpp.find("matrix q = matrix::multiply(p, p);") !=
+                  string::npos);
+        TS_ASSERT(cpp.find("f = (n * 1.5f);") != string::npos);
+        // A statement translates alone as it does in its program.
+        TS_ASSERT_EQUALS(stmts->stmt(4)->CppCode(),
+                         "matrix q = matrix::multiply(p, p);\n");
+    }
+
+    void test_type_checker_reports_errors(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; string s; n = s + 1; if (n) print(z); "
+            "{ int w; } w = 2; n = n_rows(n) * (s + 2); }");
+        TS_ASSERT(pr.ok());
+        TypeChecker checker;
+        checker.Check(pr.ast());
+        vector<string> expected = {
+            "+ does not apply to string and int",
+            "z is not declared",
+            "if statement's condition is not a boolean",
+            "w is not declared",
+            "n_rows takes a matrix",
+            "+ does not apply to string and int"
+        };
+        TS_ASSERT_EQUALS(checker.errors(), expected);
+        // Its translation skips the specializations the types would allow.
+        TS_ASSERT(pr.ast()->CppCode().find("(s + 2)") != string::npos);
+    }
+
+    void test_type_checker_compares_numbers_only(void) {
+        ParseResult pr = p.Parse(
+            "main () { boolean b; string s; "
+            "matrix m = matrix_read(\"m\"); b = 1 < \"x\"; b = 1 < m; "
+            "b = 1.5 >= True; b = s <= 2; b = 2 > 1.5; }");
+        TS_ASSERT(pr.ok());
+        TypeChecker checker;
+        checker.Check(pr.ast());
+        vector<string> expected = {
+            "< does not apply to int and string",
+            "< does not apply to int and matrix",
+            ">= does not apply to float and boolean",
+            "<= does not apply to string and int"
+        };
+        TS_ASSERT_EQUALS(checker.errors(), expected);
+        Stmts *stmts = static_cast<Program *>(pr.ast())->stmts();
+        for (size_t i = 3; i < 7; i++) {
+            TS_ASSERT_EQUALS(
+                static_cast<AssignStmt *>(stmts->stmt(i))->expr()->type(),
+                kNoType);
+        }
+        TS_ASSERT_EQUALS(
+            static_cast<AssignStmt *>(stmts->stmt(7))->expr()->type(),
+            kBoolType);
+    }
+
+    void test_simplifier_folds_constants(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; float f; boolean b; n = 2 + 3 * 4; "
+            "f = 1.5 * 2 + n; b = 2 < 1.5; n = (n * 1) + 0; n = 1 - 2; "
+            "f = 1.0 / 3; f = f + 0; b = !!(n > 1); "
+            "n = if True then n else 7 / 0; "
+            "n = 3 * if !False then n + 1 else n; }");
+        TS_ASSERT(pr.ok());
+        TypeChecker().Check(pr.ast());
+        Simplifier simplifier(pr.arena().get());
+        TS_ASSERT_EQUALS(simplifier.Simplify(pr.ast()), pr.ast());
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                         "main() {\nint n;\nfloat f;\nboolean b;\n"
+                         "n = 14;\nf = 3.0 + n;\nb = False;\nn = n;\n"
+                         "n = 1 - 2;\nf = 0.33333334;\nf = f + 0;\n"
+                         "b = n > 1;\nn = n;\nn = 3 * (n + 1);\n}");
+        string cpp = pr.ast()->CppCode();
+        TS_ASSERT(cpp.find("f = 0.33333334f;") != string::npos);
+        TS_ASSERT(cpp.find("n = (3 * ((n + 1)));") != string::npos);
+    }
+
+    void test_simplifier_drops_groups(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; boolean b; n = ((n + 1)) * (2 - n); "
+            "n = (n * 2) + (3 * n); n = n - (1 + n); n = (n - 1) - n; "
+            "print ((n)); b = ((n < 1)) == (n > 2); b = (((n) < 1)); "
+            "n = (n / n) * (n * n); }");
+        TS_ASSERT(pr.ok());
+        TypeChecker().Check(pr.ast());
+        Simplifier(pr.arena().get()).Simplify(pr.ast());
+        string text = pr.ast()->UnParse();
+        TS_ASSERT_EQUALS(text,
+                         "main() {\nint n;\nboolean b;\n"
+                         "n = (n + 1) * (2 - n);\nn = n * 2 + 3 * n;\n"
+                         "n = n - (1 + n);\nn = n - 1 - n;\nprint (n);"
+                         "b = (n < 1) == (n > 2);\nb = n < 1;\n"
+                         "n = n / n * (n * n);\n}");
+        ParseResult again = p.Parse(text.c_str());
+        TS_ASSERT(again.ok());
+        TS_ASSERT_EQUALS(again.ast()->UnParse(), text);
+    }
+
+    void test_dead_code_prunes_branches(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; n = 1; if (True) { print(n); } "
+            "if (False) print(1); if ((False)) print(2); else print(n); "
+            "while (False) { n = 2; } { } if (n > 1) { { } } "
+            "if (n > 2) print(3); else { } while (n > 3) { } "
+            "if (n > 4) if (n > 5) print(4); else { } else print(5); "
+            "if (let n = 2; in n end > 6) { } }");
+        TS_ASSERT(pr.ok());
+        DeadCodeEliminator pruner(pr.arena().get());
+        TS_ASSERT_EQUALS(pruner.Eliminate(pr.ast()), pr.ast());
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                         "main() {\nint n;\nn = 1;\n {print (n);} "
+                         "print (n);if (n > 2) print (3);"
+                         "while (n > 3)  {} "
+                         "if (n > 4)  {if (n > 5) print (4);}  "
+                         "else print (5);"
+                         "if (let n = 2;\nin n end > 6)  {} }");
+        ParseResult again = p.Parse(pr.ast()->UnParse().c_str());
+        TS_ASSERT(again.ok());
+    }
+
+    void test_dead_code_removes_unread_variables(void) {
+        ParseResult pr = p.Parse(
+            "main () { int n; int unused; int a; int b; int k; "
+            "matrix big = matrix_read(\"big.data\"); "
+            "matrix m = matrix_read(\"m.data\"); matrix w[2 : 2] i : j = i; "
+            "n = 1; unused = n + 2; a = 1; b = a + 1; a = b; "
+            "big[0 : 0] = 1.0; w[0 : 1] = big[0 : 0]; "
+            "if (n > 0) { k = let int t; t = n; in t end; } "
+            "repeat (k = 1 to n) { } "
+            "print(m[n : 0]); }");
+        TS_ASSERT(pr.ok());
+        DeadCodeEliminator(pr.arena().get()).Eliminate(pr.ast());
+        string cpp = pr.ast()->CppCode();
+        // The assignment to k in a let keeps k, which the loop reads.
+        TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                         "main() {\nint n;\nint k;\n"
+                         "matrix m = matrix_read(\"m.data\");\nn = 1;\n"
+                         "if (n > 0)  {k = let int t;\nt = n;\nin t end;\n} "
+                         "repeat (k = 1 to n) {} print (m [n: 0]);}");
+        TS_ASSERT(cpp.find("big.data") == string::npos);
+        TS_ASSERT(cpp.find("m.data") != string::npos);
+    }
+
+    void test_dead_code_keeps_let_statements(void) {
+        ParseResult pr = p.Parse(
+            "main () { int x; int y; int n; int unused; n = 3; "
+            "x = let print(5); in 1 end; "
+            "matrix m = let print(\"hi\"); in matrix_read(\"f\") end; "
+            "y = let while (n > 0) { } in 2 end; "
+            "unused = let int t; in 4 end; }");
+        TS_ASSERT(pr.ok());
+        DeadCodeEliminator(pr.arena().get()).Eliminate(pr.ast());
+        string text = pr.ast()->UnParse();
+        // Only the let that declares alone goes.
+        TS_ASSERT(text.find("print (5);") != string::npos);
+        TS_ASSERT(text.find("print (\"hi\");") != string::npos);
+        TS_ASSERT(text.find("while (n > 0)") != string::npos);
+        TS_ASSERT(text.find("int n;") != string::npos);
+        TS_ASSERT(text.find("unused") == string::npos);
+        string cpp = pr.ast()->CppCode();
+        TS_ASSERT(cpp.find("matrix_read(\"f\")") != string::npos);
+    }
+
     void test_sample_1(void) { unparse_tests("sample_1.dsl"); }
     void test_sample_2(void) { unparse_tests("sample_2.dsl"); }
     void test_sample_3(void) { unparse_tests("sample_3.dsl"); }
@@ -1,7 +1,10 @@
 #include <cxxtest/TestSuite.h>
 #include <iostream>
+#include "include/dead_code.h"
 #include "include/parser.h"
 #include "include/read_input.h"
+#include "include/simplifier.h"
+#include "include/type_checker.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -49,7 +52,13 @@ public:
         TSM_ASSERT(file + " failed to generate an AST.", pr1.ast() != NULL);
 
 
-        // 3. Verify that the C++ code is non-empty.
+        // 3. Verify that the program type-checks, and that the C++ code of
+        //    the simplified and pruned tree is non-empty.
+        TypeChecker checker ;
+        checker.Check(pr1.ast()) ;
+        TSM_ASSERT(file + " failed to type-check.", checker.errors().empty()) ;
+        Simplifier(pr1.arena().get()).Simplify(pr1.ast()) ;
+        DeadCodeEliminator(pr1.arena().get()).Eliminate(pr1.ast()) ;
         string cpp1 = pr1.ast()->CppCode() ;
         TSM_ASSERT ( file + " failed to generate non-empty C++ code.",
                      cpp1.length() > 0 ) ;
@@ -81,6 +90,54 @@ public:
         }
     }
 
+    // Translates and runs [program], and returns what it printed.
+    string run_program ( const string program, const string filebase ) {
+        string cppbase = "./samples/" + filebase ;
+        string cppfile = cppbase + ".cc" ;
+        string cppout = cppbase + ".output" ;
+
+        ParseResult pr = p.Parse(program.c_str());
+        TSM_ASSERT(filebase + " failed to parse.", pr.ok()) ;
+        TypeChecker checker ;
+        checker.Check(pr.ast()) ;
+        TSM_ASSERT(filebase + " failed to type-check.",
+                   checker.errors().empty()) ;
+        system ( "mkdir -p ./samples" ) ;
+        writeFile ( pr.ast()->CppCode(), cppfile ) ;
+
+        string compile = "g++ ./src/Matrix.cc -I. " + cppfile +
+                         " -o " + cppbase ;
+        TSM_ASSERT_EQUALS ( "translation of " + filebase +
+                            " failed to compile.",
+                            system ( compile.c_str() ), 0 ) ;
+        string run = cppbase + " > " + cppout ;
+        TSM_ASSERT_EQUALS ( "translation of " + filebase +
+                            " executed with errors.",
+                            system ( run.c_str() ), 0 ) ;
+        ifstream in(cppout.c_str());
+        return string((istreambuf_iterator<char>(in)),
+                      istreambuf_iterator<char>()) ;
+    }
+
+    // '!' applies to the whole expression after it, and to C++ values.
+    void test_not_expr ( void ) {
+        string output = run_program (
+            "main () { int x; x = 1; print(!x == 2); print(!True); "
+            "print(!x < 2); }", "not_expr" ) ;
+        TS_ASSERT_EQUALS ( output, "100" ) ;
+    }
+
+    // Products of matrices are summed in float, not truncated to ints.
+    void test_matrix_multiply ( void ) {
+        string output = run_program (
+            "main () { matrix a [ 2 : 2 ] i : j = i + 0.5; "
+            "matrix b [ 2 : 2 ] i : j = j * 0.25 + 1.0; "
+            "matrix c = a * b; print(c[0 : 0]); print(\" \"); "
+            "print(c[0 : 1]); print(\" \"); print(c[1 : 1]); }",
+            "matrix_multiply" ) ;
+        TS_ASSERT_EQUALS ( output, "1 1.25 3.75" ) ;
+    }
+
     void test_sample_1 ( void ) { codegen_tests ( "sample_1", true ); }
     void test_sample_2 ( void ) { codegen_tests ( "sample_2", true ); }
     void test_sample_3 ( void ) { codegen_tests ( "sample_3", true ); }
@@ -6,11 +6,18 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
+#include "include/arena.h"
+#include "include/batch.h"
+#include "include/dead_code.h"
 #include "include/ext_token.h"
 #include "include/parse_result.h"
 #include "include/parser.h"
 #include "include/read_input.h"
 #include "include/scanner.h"
+#include "include/simplifier.h"
+#include "include/thread_pool.h"
+#include "include/type_checker.h"
 
 
 // using namespace std;
@@ -111,6 +118,339 @@ class ParserTestSuite : public CxxTest::TestSuite {
     msg += "\n" + pr.errors();
     TSM_ASSERT(msg, pr.ok());
   }
+
+  void test_parse_result_owns_tree() {
+    parser::ParseResult pr;
+    {
+      parser::Parser local;
+      pr = local.Parse("main () { int x; x = 1 + 2 * x; print (x); }");
+    }
+    TS_ASSERT(pr.ok());
+    TS_ASSERT(pr.arena() != NULL);
+    TS_ASSERT(pr.arena()->bytes_allocated() > 0);
+    TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                     "main() {\nint x;\nx = 1 + 2 * x;\nprint (x);}");
+  }
+
+  void test_failed_parse_keeps_no_tree() {
+    parser::Parser local;
+    parser::ParseResult pr = local.Parse("main () { int ; }");
+    TS_ASSERT(!pr.ok());
+    TS_ASSERT(pr.ast() == NULL);
+    // The header parsed, so the arena is kept for Reparse(), but no
+    // statement in it is worth reusing.
+    TS_ASSERT(pr.outline() != NULL);
+    TS_ASSERT_EQUALS(pr.outline()->num_spans, 0u);
+
+    pr = local.Parse("main ( { int x; }");
+    TS_ASSERT(!pr.ok());
+    TS_ASSERT(pr.arena() == NULL);
+    TS_ASSERT(pr.outline() == NULL);
+  }
+
+  void test_parse_reports_every_error() {
+    parser::Parser local;
+    const char *text =
+        "main () {\n"
+        "  int ;\n"
+        "  x = 1 + 2;\n"
+        "  float f; f = * 2;\n"
+        "  if (x < 3) { print (x) }\n"
+        "}";
+    parser::ParseResult pr = local.Parse(text);
+    TS_ASSERT(!pr.ok());
+    const std::vector<parser::ParseError> &errors = pr.error_list();
+    TS_ASSERT_EQUALS(errors.size(), 3u);
+    TS_ASSERT_EQUALS(errors[0].message,
+                     "Expected 20 but found ;");
+    TS_ASSERT_EQUALS(std::string(text + errors[0].offset, 1), ";");
+    TS_ASSERT_EQUALS(errors[1].message,
+                     "Expected an expression but found '*'");
+    TS_ASSERT_EQUALS(errors[2].message, "Expected 27 but found }");
+    TS_ASSERT_EQUALS(pr.errors(),
+                     errors[0].message + "\n" + errors[1].message + "\n" +
+                     errors[2].message);
+  }
+
+  void test_parse_recovers_at_end_of_file() {
+    parser::Parser local;
+    parser::ParseResult pr = local.Parse("main () { x = ! ; y = (1 + ");
+    TS_ASSERT_EQUALS(pr.error_list().size(), 3u);
+    TS_ASSERT_EQUALS(pr.error_list()[2].message,
+                     "Expected 24 but found end of file");
+  }
+
+  void test_parse_recovers_past_broken_block_header() {
+    parser::Parser local;
+    const char *text =
+        "main () {\n"
+        "  if x) { a = 1; }\n"
+        "  b = 2;\n"
+        "  c = * 3;\n"
+        "}";
+    parser::ParseResult pr = local.Parse(text);
+    const std::vector<parser::ParseError> &errors = pr.error_list();
+    TS_ASSERT_EQUALS(errors.size(), 2u);
+    TS_ASSERT_EQUALS(errors[0].message,
+                     "Expected 21 but found variable name");
+    TS_ASSERT_EQUALS(std::string(text + errors[0].offset, 1), "x");
+    TS_ASSERT_EQUALS(errors[1].message,
+                     "Expected an expression but found '*'");
+    TS_ASSERT_EQUALS(std::string(text + errors[1].offset, 1), "*");
+  }
+
+  void test_parse_long_and_deep_programs() {
+    const size_t kCount = 100000;
+    parser::Parser local;
+    std::string text = "main () {\n";
+    for (size_t i = 0; i < kCount; i++) {
+      text += "x = 1;\n";
+    }
+    parser::ParseResult pr = local.Parse((text + "}").c_str());
+    TS_ASSERT(pr.ok());
+    TS_ASSERT_EQUALS(body(pr).size(), kCount);
+    TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                     "main() {\n" + text.substr(10) + "}");
+
+    text = "main () { x = " + std::string(kCount, '(') + "1" +
+        std::string(kCount, ')') + "; }";
+    pr = local.Parse(text.c_str());
+    TS_ASSERT(pr.ok());
+    fcal::ast::Expr *e =
+        static_cast<fcal::ast::AssignStmt *>(body(pr)[0])->expr();
+    size_t depth = 0;
+    fcal::ast::GroupExpr *group;
+    while ((group = dynamic_cast<fcal::ast::GroupExpr *>(e)) != NULL) {
+      e = group->expr();
+      depth++;
+    }
+    TS_ASSERT_EQUALS(depth, kCount);
+  }
+
+  void test_parse_not_expr() {
+    parser::Parser local;
+    parser::ParseResult pr = local.Parse("main () { b = !x == y; }");
+    TS_ASSERT(pr.ok());
+    TS_ASSERT_EQUALS(body(pr)[0]->UnParse(), "b = !x == y;\n");
+    TS_ASSERT_EQUALS(body(pr)[0]->CppCode(), "b = !(x == y);\n");
+  }
+
+  void test_arena_reset_runs_destructors() {
+    struct Counted {
+      explicit Counted(int *count) : count_(count) {}
+      ~Counted(void) { ++*count_; }
+      int *count_;
+    };
+    int destroyed = 0;
+    fcal::Arena arena;
+    for (int i = 0; i < 10000; i++) {
+      arena.New<Counted>(&destroyed);
+    }
+    size_t num_blocks = arena.num_blocks();
+    TS_ASSERT(num_blocks > 1);
+    char *big = static_cast<char *>(arena.Allocate(fcal::kArenaBlockSize, 8));
+    big[fcal::kArenaBlockSize - 1] = 'x';
+    TS_ASSERT_EQUALS(arena.num_blocks(), num_blocks + 1);
+
+    // The oversized block goes; the others are kept and used again.
+    arena.Reset();
+    TS_ASSERT_EQUALS(destroyed, 10000);
+    TS_ASSERT_EQUALS(arena.bytes_allocated(), 0u);
+    TS_ASSERT_EQUALS(arena.num_blocks(), num_blocks);
+    for (int i = 0; i < 10000; i++) {
+      arena.New<Counted>(&destroyed);
+    }
+    TS_ASSERT_EQUALS(arena.num_blocks(), num_blocks);
+
+    arena.Release();
+    TS_ASSERT_EQUALS(destroyed, 20000);
+    TS_ASSERT_EQUALS(arena.num_blocks(), 0u);
+  }
+
+  void test_parser_recycles_arena() {
+    parser::Parser local;
+    const char *text = "main () { int x; x = 1; }";
+    fcal::Arena *first = local.Parse(text).arena().get();
+
+    // Nothing holds the first tree any more, so its arena is reused.
+    parser::ParseResult kept = local.Parse(text);
+    TS_ASSERT_EQUALS(kept.arena().get(), first);
+
+    // This time [kept] still holds it, and must not be disturbed.
+    parser::ParseResult other = local.Parse(text);
+    TS_ASSERT_DIFFERS(other.arena().get(), first);
+    local.Reset();
+    TS_ASSERT_EQUALS(kept.ast()->UnParse(), "main() {\nint x;\nx = 1;\n}");
+    TS_ASSERT_EQUALS(other.ast()->UnParse(), kept.ast()->UnParse());
+  }
+
+  /* The statements of a program's body, in order */
+  static std::vector<fcal::ast::Stmt *> body(parser::ParseResult pr) {
+    fcal::ast::Stmts *ss = static_cast<fcal::ast::Program *>(pr.ast())->stmts();
+    return std::vector<fcal::ast::Stmt *>(ss->begin(), ss->end());
+  }
+
+  /* Replaces [removed] bytes of [text] at the first [at] with [inserted] */
+  static parser::TextEdit edit(std::string *text, const std::string &at,
+                               size_t removed, const std::string &inserted) {
+    parser::TextEdit e;
+    e.offset = text->find(at);
+    e.removed = removed;
+    e.inserted = inserted.size();
+    text->replace(e.offset, removed, inserted);
+    return e;
+  }
+
+  void test_reparse_reuses_untouched_statements() {
+    parser::Parser local;
+    parser::Parser full;
+    std::string text = "main () {\n int x;\n x = 1;\n print (x);\n}";
+    parser::ParseResult pr = local.Parse(text.c_str());
+    std::vector<fcal::ast::Stmt *> before = body(pr);
+
+    std::vector<parser::TextEdit> edits;
+    edits.push_back(edit(&text, "1;", 1, "10 + x"));
+    edits.push_back(edit(&text, "print", 0, "x = 2; "));
+    pr = local.Reparse(pr, text.c_str(), edits);
+    TS_ASSERT(pr.ok());
+    TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                     full.Parse(text.c_str()).ast()->UnParse());
+
+    std::vector<fcal::ast::Stmt *> after = body(pr);
+    TS_ASSERT_EQUALS(after.size(), 4u);
+    TS_ASSERT_EQUALS(after[0], before[0]);
+    TS_ASSERT_DIFFERS(after[1], before[1]);
+    TS_ASSERT_EQUALS(after[3], before[2]);
+    TS_ASSERT_EQUALS(pr.outline()->spans[3].begin, text.find("print"));
+  }
+
+  /* An 'else' typed after an 'if' changes the statement before the edit */
+  void test_reparse_rereads_lookahead() {
+    parser::Parser local;
+    parser::Parser full;
+    std::string text = "main () { if (x) x = 1; print (x); }";
+    parser::ParseResult pr = local.Parse(text.c_str());
+
+    std::vector<parser::TextEdit> edits;
+    edits.push_back(edit(&text, "print", 0, "else x = 2; "));
+    pr = local.Reparse(pr, text.c_str(), edits);
+    TS_ASSERT(pr.ok());
+    TS_ASSERT(dynamic_cast<fcal::ast::IfElseStmt *>(body(pr)[0]) != NULL);
+    TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                     full.Parse(text.c_str()).ast()->UnParse());
+  }
+
+  /* Reparsing a broken text reports what a full parse would, and keeps the
+     statements that did parse for the next edit */
+  void test_reparse_through_errors() {
+    parser::Parser local;
+    parser::Parser full;
+    std::string text = "main () { int x; x = 1; x = 2; print (x); }";
+    parser::ParseResult pr = local.Parse(text.c_str());
+    std::vector<fcal::ast::Stmt *> before = body(pr);
+
+    std::vector<parser::TextEdit> edits(1, edit(&text, "1;", 1, ""));
+    pr = local.Reparse(pr, text.c_str(), edits);
+    parser::ParseResult expected = full.Parse(text.c_str());
+    TS_ASSERT(!pr.ok());
+    TS_ASSERT_EQUALS(pr.errors(), expected.errors());
+    TS_ASSERT_EQUALS(pr.error_list()[0].offset,
+                     expected.error_list()[0].offset);
+
+    edits[0] = edit(&text, " ;", 0, " 3");
+    pr = local.Reparse(pr, text.c_str(), edits);
+    TS_ASSERT(pr.ok());
+    TS_ASSERT_EQUALS(pr.ast()->UnParse(),
+                     full.Parse(text.c_str()).ast()->UnParse());
+    std::vector<fcal::ast::Stmt *> after = body(pr);
+    TS_ASSERT_EQUALS(after[0], before[0]);
+    TS_ASSERT_EQUALS(after[2], before[2]);
+    TS_ASSERT_EQUALS(after[3], before[3]);
+  }
+
+  /* Programs of very different sizes, some broken */
+  static std::vector<std::string> batch_programs(void) {
+    std::vector<std::string> programs;
+    for (int i = 0; i < 200; i++) {
+      std::ostringstream text;
+      text << "main () { int x; ";
+      for (int j = 0; j < (i * 37) % 300; j++) {
+        text << "x = x + " << j << "; ";
+      }
+      text << ((i % 7 == 0) ? "x = ; " : "") << "print (x); }";
+      programs.push_back(text.str());
+    }
+    return programs;
+  }
+
+  /* Each result is the one a lone Parser gives, in the order given */
+  void test_parse_many_keeps_order() {
+    std::vector<std::string> programs = batch_programs();
+    std::vector<const char *> texts;
+    for (size_t i = 0; i < programs.size(); i++) {
+      texts.push_back(programs[i].c_str());
+    }
+    fcal::ThreadPool pool(4);
+    std::vector<parser::ParseResult> results = parser::ParseMany(texts, &pool);
+    TS_ASSERT_EQUALS(results.size(), texts.size());
+
+    parser::Parser local;
+    for (size_t i = 0; i < texts.size() && i < results.size(); i++) {
+      parser::ParseResult expected = local.Parse(texts[i]);
+      TS_ASSERT_EQUALS(results[i].ok(), expected.ok());
+      TS_ASSERT_EQUALS(results[i].errors(), expected.errors());
+      if (expected.ok() && results[i].ok()) {
+        TS_ASSERT_EQUALS(results[i].ast()->UnParse(),
+                         expected.ast()->UnParse());
+      }
+    }
+  }
+
+  void test_translate_many() {
+    std::vector<std::string> programs = batch_programs();
+    std::vector<const char *> texts;
+    for (size_t i = 0; i < programs.size(); i++) {
+      texts.push_back(programs[i].c_str());
+    }
+    fcal::ThreadPool pool(3);
+    std::vector<parser::Translation> results =
+        parser::TranslateMany(texts, &pool);
+    TS_ASSERT_EQUALS(results.size(), texts.size());
+
+    parser::Parser local;
+    for (size_t i = 0; i < texts.size() && i < results.size(); i++) {
+      parser::ParseResult expected = local.Parse(texts[i]);
+      TS_ASSERT_EQUALS(results[i].ok, expected.ok());
+      std::string cpp;
+      if (expected.ok()) {
+        fcal::ast::TypeChecker().Check(expected.ast());
+        fcal::ast::Simplifier(expected.arena().get())
+            .Simplify(expected.ast());
+        fcal::ast::DeadCodeEliminator(expected.arena().get())
+            .Eliminate(expected.ast());
+        cpp = expected.ast()->CppCode();
+      }
+      TS_ASSERT_EQUALS(results[i].cpp, cpp);
+      TS_ASSERT_EQUALS(results[i].errors, expected.errors());
+    }
+  }
+
+  void test_translate_many_reports_type_errors() {
+    std::vector<const char *> texts = {
+        "main () { int x; string s; x = s; print (x < \"s\"); }",
+        "main () { int x; x = 1; print (x); }"};
+    fcal::ThreadPool pool(2);
+    std::vector<parser::Translation> results =
+        parser::TranslateMany(texts, &pool);
+    TS_ASSERT_EQUALS(results.size(), 2u);
+    TS_ASSERT(!results[0].ok);
+    TS_ASSERT_EQUALS(results[0].cpp, "");
+    TS_ASSERT_EQUALS(results[0].errors,
+                     "string assigned to x, a int\n"
+                     "< does not apply to int and string");
+    TS_ASSERT(results[1].ok);
+    TS_ASSERT_EQUALS(results[1].errors, "");
+  }
 };
 
 #endif  // GITHUB_3081_REPO_GROUP_NEWTON_PROJECT_TESTS_PARSER_TESTS_H_
@@ -40,6 +40,52 @@ class RegexTestSuite : public CxxTest::TestSuite {
     std::string lex(text, numMatchedChars);
     TS_ASSERT_EQUALS(lex, "123");
   }
+
+  // Tests for the lazy DFA behind make_regex and match_regex
+  // --------------------------------------------------
+  void test_make_regex_bad_pattern(void) {
+    TS_ASSERT(fcal::scanner::make_regex("^(ab") == NULL);
+    TS_ASSERT(fcal::scanner::make_regex("^a{2}") == NULL);
+  }
+
+  void test_match_regex_longest(void) {
+    regex_t *re = fcal::scanner::make_regex("^(ab|a)*(b|c)?c+");
+    TS_ASSERT(re);
+    TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, "ababacc!"), 7);
+    TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, "abab"), 0);
+    TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, "cc\0cc"), 2);
+    fcal::scanner::free_regex(re);
+  }
+
+  void test_match_regex_always_anchored(void) {
+    regex_t *re = fcal::scanner::make_regex("[0-9]+");
+    TS_ASSERT(re);
+    TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, "42 "), 2);
+    TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, " 42"), 0);
+    fcal::scanner::free_regex(re);
+  }
+
+  void test_match_regex_cache_flush(void) {
+    // The 9th byte from the end must be an 'a'; that needs 512 DFA states,
+    // far more than the cache holds.
+    regex_t *re = fcal::scanner::make_regex(
+        "^(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)");
+    TS_ASSERT(re);
+    std::string text;
+    for (int i = 0; i < 2000; i++) {
+      text += "abbabaabbbaab"[i % 13];
+    }
+    int expected = 0;
+    for (size_t i = 0; i + 9 <= text.size(); i++) {
+      if (text[i] == 'a') {
+        expected = static_cast<int>(i) + 9;
+      }
+    }
+    for (int round = 0; round < 3; round++) {
+      TS_ASSERT_EQUALS(fcal::scanner::match_regex(re, text.c_str()), expected);
+    }
+    fcal::scanner::free_regex(re);
+  }
 };
 
 #endif  // GITHUB_3081_REPO_GROUP_NEWTON_PROJECT_TESTS_REGEX_TESTS_H_
@@ -6,8 +6,15 @@
 #include <cxxtest/TestSuite.h>
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <thread>
 #include "include/read_input.h"
 #include "include/scanner.h"
+#include "include/skip.h"
+#include "include/thread_pool.h"
 
 // using namespace std;
 namespace scanner = fcal::scanner;
@@ -562,6 +569,36 @@ class ScannerTestSuite : public CxxTest::TestSuite {
         TS_ASSERT(ret.type == fcal::scanner::kNotOp);
         }
 
+    /* the DFA takes the longest match, and keywords only win ties */
+    void test_terminal_keyword_prefix() {
+        fcal::scanner::Result ret = s->find_TokenType("integer = 1");
+        TS_ASSERT_EQUALS(ret.length, 7);
+        TS_ASSERT(ret.type == fcal::scanner::kVariableName);
+        }
+    void test_terminal_longest_float() {
+        fcal::scanner::Result ret = s->find_TokenType("12.34.5");
+        TS_ASSERT_EQUALS(ret.length, 5);
+        TS_ASSERT(ret.type == fcal::scanner::kFloatConst);
+        }
+    void test_lookup_keyword() {
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("boolean", 7),
+                         scanner::kBoolKwd);
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("to", 2), scanner::kToKwd);
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("True", 4),
+                         scanner::kTrueKwd);
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("true", 4),
+                         scanner::kVariableName);
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("int_", 4),
+                         scanner::kVariableName);
+        TS_ASSERT_EQUALS(scanner::lookup_keyword("ib", 2),
+                         scanner::kVariableName);
+        }
+    void test_terminal_no_match() {
+        fcal::scanner::Result ret = s->find_TokenType("$x");
+        TS_ASSERT_EQUALS(ret.length, 0);
+        TS_ASSERT(ret.type == fcal::scanner::kEndOfFile);
+        }
+
 
     /* Below is one of the tests for these components in the project
        solution created by your instructor.  It uses a helper
@@ -872,6 +909,213 @@ class ScannerTestSuite : public CxxTest::TestSuite {
         TS_ASSERT(sameTerminals(tks, 4, ts));
     }
 
+    // The token stream holds spans of the text rather than copies.
+    void test_tokenize_spans() {
+        const char *text = " 123 x 12.34 ";
+        scanner::TokenStream tokens;
+        s->Tokenize(text, &tokens);
+        TS_ASSERT_EQUALS(tokens.size(), 4u);
+        TS_ASSERT_EQUALS(tokens.text(), text);
+        TS_ASSERT_EQUALS(tokens.terminal(0), scanner::kIntConst);
+        TS_ASSERT_EQUALS(tokens[0].offset, 1u);
+        TS_ASSERT_EQUALS(tokens[0].length, 3u);
+        TS_ASSERT_EQUALS(tokens.lexeme(2), "12.34");
+        TS_ASSERT_EQUALS(tokens.terminal(3), scanner::kEndOfFile);
+        TS_ASSERT_EQUALS(tokens[3].offset, 13u);
+        TS_ASSERT_EQUALS(tokens[3].length, 0u);
+    }
+
+    /* The bounded scan stops at the length, even inside a token, and treats
+       an embedded NUL as an ordinary bad character */
+    void test_tokenize_bounded() {
+        const char text[] = { 'a', 'b', ' ', '\0', '1', '2', '3', '4' };
+        scanner::TokenStream tokens;
+        s->Tokenize(text, 6, &tokens);
+        TS_ASSERT_EQUALS(tokens.size(), 4u);
+        TS_ASSERT_EQUALS(tokens.lexeme(0), "ab");
+        TS_ASSERT_EQUALS(tokens.terminal(1), scanner::kLexicalError);
+        TS_ASSERT_EQUALS(tokens[1].offset, 3u);
+        TS_ASSERT_EQUALS(tokens.terminal(2), scanner::kIntConst);
+        TS_ASSERT_EQUALS(tokens.lexeme(2), "12");
+        TS_ASSERT_EQUALS(tokens[3].offset, 6u);
+
+        scanner::Token *tks = s->Scan("x /* comment */ y", 8);
+        TS_ASSERT_EQUALS(tks->terminal(), scanner::kVariableName);
+        TS_ASSERT_EQUALS(tks->next()->terminal(), scanner::kForwardSlash);
+        TS_ASSERT_EQUALS(tks->next()->next()->terminal(), scanner::kStar);
+        delete tks;
+    }
+
+    /* Every skipper this CPU supports must agree, on runs long enough to
+       use the vector strides and on comments that are never closed */
+    void test_skip_impls() {
+        std::string blanks(40, ' ');
+        std::string body(50, 'x');
+        struct { std::string text; size_t skipped; } cases[] = {
+            { "x", 0 },
+            { blanks + "\t\r\nx", 43 },
+            { blanks + "/*" + body + "**/ x", 96 },
+            { "/*" + body + "\\ */", 0 },
+            { "/*/" + body + "*/" + body, 55 },
+            { "/*" + body, 0 },
+            { "//" + body + "\n" + blanks + "//", 93 },
+            { blanks + "//" + body, 40 },
+            { "/" + body, 0 },
+        };
+        for (int impl = 0; impl < scanner::kNumSkipImpls; impl++) {
+            for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+                const std::string &t = cases[i].text;
+                TS_ASSERT_EQUALS(scanner::skip_whitespace_and_comments(
+                    t.data(), t.data() + t.size(),
+                    static_cast<scanner::SkipImpl>(impl)), cases[i].skipped);
+            }
+        }
+        std::string nul = "/*" + body + std::string(1, '\0') + "*/";
+        TS_ASSERT_EQUALS(scanner::skip_whitespace_and_comments(
+            nul.data(), nul.data() + nul.size()), 0u);
+    }
+
+    /* Splits never fall inside a string constant or a comment, but do
+       fall after ones that are never closed */
+    void test_find_split_points() {
+        const char *text = "\"a b c\" /* d e */ f g \" h // i\n j";
+        std::vector<size_t> splits =
+            scanner::find_split_points(text, strlen(text), 1);
+        size_t expected[] = { 7, 19, 21, 23, 25 };
+        TS_ASSERT_EQUALS(splits.size(), 5u);
+        for (size_t i = 0; i < splits.size() && i < 5; i++) {
+            TS_ASSERT_EQUALS(splits[i], expected[i]);
+        }
+    }
+
+    /* The parallel scan gives exactly the single-threaded tokens */
+    void test_tokenize_parallel() {
+        std::string text;
+        for (int i = 0; i < 200; i++) {
+            text += "x = \"a b\" + 1.5 ; /* c d */ // e f\n \" g / h\n";
+        }
+        scanner::TokenStream seq, par;
+        s->Tokenize(text.data(), text.size(), &seq);
+        fcal::ThreadPool pool(3);
+        s->Tokenize(text.data(), text.size(), &par, &pool, 7);
+        TS_ASSERT_EQUALS(par.size(), seq.size());
+        for (size_t i = 0; i < seq.size() && i < par.size(); i++) {
+            TS_ASSERT_EQUALS(par[i].offset, seq[i].offset);
+            TS_ASSERT_EQUALS(par[i].length, seq[i].length);
+            TS_ASSERT_EQUALS(par.terminal(i), seq.terminal(i));
+        }
+    }
+
+    /* Peek looks ahead without taking tokens, and Next keeps returning
+       kEndOfFile once the text is used up */
+    void test_next_and_peek() {
+        const char *text = "x = 12 ;";
+        s->Start(text, strlen(text));
+        TS_ASSERT_EQUALS(s->Peek(2).terminal, scanner::kIntConst);
+        TS_ASSERT_EQUALS(s->Peek(0).terminal, scanner::kVariableName);
+
+        scanner::CompactToken t = s->Next();
+        TS_ASSERT_EQUALS(s->lexeme(t), "x");
+        TS_ASSERT_EQUALS(s->Next().terminal, scanner::kAssign);
+        t = s->Next();
+        TS_ASSERT_EQUALS(s->lexeme(t), "12");
+        TS_ASSERT_EQUALS(s->Peek(scanner::Scanner::kLookahead - 1).terminal,
+                         scanner::kEndOfFile);
+        TS_ASSERT_EQUALS(s->Next().terminal, scanner::kSemiColon);
+        TS_ASSERT_EQUALS(s->Next().terminal, scanner::kEndOfFile);
+        t = s->Next();
+        TS_ASSERT_EQUALS(t.terminal, scanner::kEndOfFile);
+        TS_ASSERT_EQUALS(t.offset, strlen(text));
+    }
+
+    /* A regular file is mapped, not copied, and the scanner reads the
+       mapping in place */
+    void test_input_buffer_mapped() {
+        char path[] = "/tmp/fcal_input_XXXXXX";
+        int fd = mkstemp(path);
+        TS_ASSERT(fd >= 0);
+        const char *text = "main () { int x ; x = 4 ; }";
+        TS_ASSERT_EQUALS(write(fd, text, strlen(text)),
+                         static_cast<ssize_t>(strlen(text)));
+        close(fd);
+
+        scanner::InputBuffer input;
+        TS_ASSERT(input.Open(path));
+        TS_ASSERT(input.mapped());
+        TS_ASSERT_EQUALS(input.size(), strlen(text));
+        scanner::TokenStream mapped, copied;
+        s->Tokenize(input.data(), input.size(), &mapped);
+        s->Tokenize(text, &copied);
+        TS_ASSERT_EQUALS(mapped.size(), copied.size());
+
+        char *legacy = scanner::ReadInputFromFile(path);
+        TS_ASSERT_EQUALS(strcmp(legacy, text), 0);
+        delete[] legacy;
+        unlink(path);
+        TS_ASSERT(!input.Open(path));
+        TS_ASSERT_EQUALS(input.size(), 0u);
+    }
+
+    /* A pipe cannot be mapped, so it is read to the end instead */
+    void test_input_buffer_pipe() {
+        int fds[2];
+        TS_ASSERT_EQUALS(pipe(fds), 0);
+        const char *text = "print ( 1 ) ;";
+        TS_ASSERT_EQUALS(write(fds[1], text, strlen(text)),
+                         static_cast<ssize_t>(strlen(text)));
+        close(fds[1]);
+
+        char path[32];
+        snprintf(path, sizeof(path), "/dev/fd/%d", fds[0]);
+        scanner::InputBuffer input;
+        TS_ASSERT(input.Open(path));
+        close(fds[0]);
+        TS_ASSERT(!input.mapped());
+        TS_ASSERT_EQUALS(std::string(input.data(), input.size()), text);
+    }
+
+    /* Programs can be streamed in through a descriptor or stdin; the
+       writer here outruns the pipe's buffer several times over */
+    void test_read_input_stream() {
+        std::string program;
+        while (program.size() < 300 * 1024) {
+            program += "x = x + 1 ; // step\n";
+        }
+        for (int round = 0; round < 2; round++) {
+            int fds[2];
+            TS_ASSERT_EQUALS(pipe(fds), 0);
+            std::thread writer([&]() {
+                size_t done = 0;
+                while (done < program.size()) {
+                    ssize_t n = write(fds[1], program.data() + done,
+                                      program.size() - done);
+                    TS_ASSERT(n > 0);
+                    done += n;
+                }
+                close(fds[1]);
+            });
+
+            char *text;
+            if (round == 0) {
+                text = scanner::ReadInputFromFd(fds[0]);
+            } else {
+                int saved = dup(STDIN_FILENO);
+                dup2(fds[0], STDIN_FILENO);
+                char name[] = "fcal";
+                char dash[] = "-";
+                char *argv[] = { name, dash, NULL };
+                text = scanner::ReadInput(2, argv);
+                dup2(saved, STDIN_FILENO);
+                close(saved);
+            }
+            writer.join();
+            close(fds[0]);
+            TS_ASSERT(text);
+            TS_ASSERT(program == text);
+            delete[] text;
+        }
+    }
+
 
     /* This test checks that the scanner returns a list of tokens with
        the correct terminal fields.  It doesn't check that the lexemes